@@ -21,6 +21,8 @@ int unsetAlias(data_t *data, char *string)
 		return (1);
 	savedChar = *eqlPosition;
 	*eqlPosition = 0;
+	touchSnapshot(data, SNAP_ALIAS);
+	clearCmdCache(data);
 	result = removeNodeAtIdx(&(data->aliasList),
 			findNodeIndex(data->aliasList,
 			findNodeWithPrefix(data->aliasList, string, -1)));
@@ -50,17 +52,20 @@ int setAlias(data_t *data, char *string)
 		return (unsetAlias(data, string));
 
 	unsetAlias(data, string);
+	touchSnapshot(data, SNAP_ALIAS);
+	clearCmdCache(data);
 	return (appendNodeToList(&(data->aliasList), string, 0) == NULL);
 }
 
 /**
  * printAlias - Prints an alias string.
+ * @data: Pointer to the data_t struct containing shell information.
  * @node: Pointer to the alias node containing the string to be printed.
  *
  * Return: 0 if successful, or 1 otherwise.
  */
 
-int printAlias(item_t *node)
+int printAlias(data_t *data, item_t *node)
 {
 	char *eqlPosition = NULL, *a = NULL;
 
@@ -68,10 +73,10 @@ int printAlias(item_t *node)
 	{
 		eqlPosition = findChar(node->string, '=');
 		for (a = node->string; a <= eqlPosition; a++)
-			putChar(*a);
-		putChar('\'');
-		putStr(eqlPosition + 1);
-		putStr("'\n");
+			putChar(data, *a);
+		putChar(data, '\'');
+		putStr(data, eqlPosition + 1);
+		putStr(data, "'\n");
 		return (0);
 	}
 	return (1);
@@ -96,7 +101,7 @@ int manageAlias(data_t *data)
 		node = data->aliasList;
 		while (node)
 		{
-			printAlias(node);
+			printAlias(data, node);
 			node = node->next;
 		}
 		return (0);
@@ -107,7 +112,7 @@ int manageAlias(data_t *data)
 		if (eqlPosition)
 			setAlias(data, data->argv[i]);
 		else
-			printAlias(findNodeWithPrefix(data->aliasList, data->argv[i], '='));
+			printAlias(data, findNodeWithPrefix(data->aliasList, data->argv[i], '='));
 	}
 
 	return (0);
@@ -125,6 +130,6 @@ int manageAlias(data_t *data)
 
 int dispHistory(data_t *data)
 {
-	displayList(data->historyList);
+	displayList(data, data->historyList);
 	return (0);
 }
@@ -0,0 +1,111 @@
+#include "shell.h"
+
+/**
+ * newProgram - Creates an empty program with one holder.
+ *
+ * Return: The new program, or NULL on allocation failure.
+ */
+
+program_t *newProgram(void)
+{
+	program_t *prog = malloc(sizeof(program_t));
+
+	if (!prog)
+		return (NULL);
+	prog->arena = NULL;
+	prog->root = NULL;
+	prog->refs = 1;
+	return (prog);
+}
+
+/**
+ * arenaAlloc - Allocates zeroed memory from a program's arena.
+ * @prog: The program that owns the memory.
+ * @size: Number of bytes needed.
+ *
+ * Memory is handed out from large blocks and only given back when the
+ * whole program is released, so building a tree costs a handful of
+ * malloc() calls however many nodes it has.
+ *
+ * Return: The memory, or NULL on allocation failure.
+ */
+
+void *arenaAlloc(program_t *prog, size_t size)
+{
+	arena_block_t *block = prog->arena;
+	size_t blockSize = ARENA_BLOCK_SIZE;
+	char *mem;
+
+	size = (size + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+	if (!block || block->used + size > block->size)
+	{
+		while (blockSize < size)
+			blockSize *= 2;
+		block = malloc(sizeof(arena_block_t) + blockSize);
+		if (!block)
+			return (NULL);
+		block->next = prog->arena;
+		block->used = 0;
+		block->size = blockSize;
+		prog->arena = block;
+	}
+	mem = (char *)(block + 1) + block->used;
+	block->used += size;
+	fillMemWithByte(mem, 0, size);
+	return (mem);
+}
+
+/**
+ * arenaStrN - Copies part of a string into a program's arena.
+ * @prog: The program that owns the copy.
+ * @str: The string to copy.
+ * @length: Number of characters to copy.
+ *
+ * Return: The NUL-terminated copy, or NULL on allocation failure.
+ */
+
+char *arenaStrN(program_t *prog, char *str, int length)
+{
+	char *copy = arenaAlloc(prog, length + 1);
+
+	if (copy)
+		copySubstr(copy, str, length + 1);
+	return (copy);
+}
+
+/**
+ * retainProgram - Adds a holder to a program.
+ * @prog: The program.
+ *
+ * Return: @prog.
+ */
+
+program_t *retainProgram(program_t *prog)
+{
+	if (prog)
+		prog->refs++;
+	return (prog);
+}
+
+/**
+ * releaseProgram - Drops a holder of a program, freeing it with its arena
+ * once nothing holds it any more.
+ * @prog: The program (may be NULL).
+ *
+ * Return: Nothing.
+ */
+
+void releaseProgram(program_t *prog)
+{
+	arena_block_t *block;
+
+	if (!prog || --prog->refs > 0)
+		return;
+	while (prog->arena)
+	{
+		block = prog->arena;
+		prog->arena = block->next;
+		free(block);
+	}
+	free(prog);
+}
@@ -0,0 +1,172 @@
+#include "shell.h"
+
+/**
+ * arithVarGet - Reads a variable as a 64-bit integer.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The variable node.
+ *
+ * Unset, empty and non-numeric variables evaluate to 0.
+ *
+ * Return: The variable's value.
+ */
+
+long arithVarGet(data_t *data, arith_node_t *node)
+{
+	char *value = lookupVar(data, node->name, node->nameLen);
+	long result = 0;
+	int negative = 0;
+
+	if (!value)
+		return (0);
+	while (isDelim(*value, " \t\n"))
+		value++;
+	if (*value == '-' || *value == '+')
+		negative = (*value++ == '-');
+	arithParseNumber(value, &result);
+	return (negative ? -result : result);
+}
+
+/**
+ * arithVarSet - Assigns a 64-bit integer to a variable.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The variable node.
+ * @value: The value to assign.
+ *
+ * Return: @value.
+ */
+
+long arithVarSet(data_t *data, arith_node_t *node, long value)
+{
+	char name[ARITH_NAME_MAX];
+	int length = node->nameLen < ARITH_NAME_MAX ? node->nameLen
+		: ARITH_NAME_MAX - 1;
+
+	copySubstr(name, node->name, length + 1);
+	initEnvVar(data, name, convertNum(data, value, 10, 0));
+	return (value);
+}
+
+/**
+ * arithApply - Applies a binary operator to two values.
+ * @op: The operator code.
+ * @left: The left operand.
+ * @right: The right operand.
+ * @error: Set to 1 on division by zero.
+ *
+ * Return: The result.
+ */
+
+long arithApply(int op, long left, long right, int *error)
+{
+	switch (op)
+	{
+	case AOP('|', 0, 0): return (left | right);
+	case AOP('^', 0, 0): return (left ^ right);
+	case AOP('&', 0, 0): return (left & right);
+	case AOP('=', '=', 0): return (left == right);
+	case AOP('!', '=', 0): return (left != right);
+	case AOP('<', 0, 0): return (left < right);
+	case AOP('>', 0, 0): return (left > right);
+	case AOP('<', '=', 0): return (left <= right);
+	case AOP('>', '=', 0): return (left >= right);
+	case AOP('<', '<', 0): return ((long)((unsigned long)left << (right & 63)));
+	case AOP('>', '>', 0): return (left >> (right & 63));
+	case AOP('+', 0, 0): return ((long)((unsigned long)left + right));
+	case AOP('-', 0, 0): return ((long)((unsigned long)left - right));
+	case AOP('*', 0, 0): return ((long)((unsigned long)left * right));
+	case AOP('=', 0, 0): return (right);
+	}
+	if (right == 0 || (right == -1 && left == LONG_MIN))
+	{
+		*error = right == 0;
+		return (right ? (op == AOP('/', 0, 0) ? left : 0) : 0);
+	}
+	return (op == AOP('/', 0, 0) ? left / right : left % right);
+}
+
+/**
+ * arithEvalNode - Evaluates one node of a compiled expression.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @expr: The compiled expression.
+ * @idx: Index of the node to evaluate.
+ * @error: Set to 1 if evaluation fails.
+ *
+ * && || and ?: only evaluate the operands they need.
+ *
+ * Return: The value of the node.
+ */
+
+long arithEvalNode(data_t *data, arith_expr_t *expr, int idx, int *error)
+{
+	arith_node_t *node = &expr->nodes[idx];
+	long left, right;
+
+	switch (node->kind)
+	{
+	case ARITH_NUM: case ARITH_PARAM:
+		return (node->value);
+	case ARITH_VAR:
+		return (arithVarGet(data, node));
+	case ARITH_TERNARY:
+		return (arithEvalNode(data, expr, arithEvalNode(data, expr,
+				node->cond, error) ? node->left : node->right, error));
+	case ARITH_PREFIX: case ARITH_POSTFIX:
+		left = arithVarGet(data, node);
+		right = left + (node->op == AOP('+', '+', 0) ? 1 : -1);
+		arithVarSet(data, node, right);
+		return (node->kind == ARITH_PREFIX ? right : left);
+	case ARITH_ASSIGN:
+		right = arithEvalNode(data, expr, node->right, error);
+		left = node->op == AOP('=', 0, 0) ? 0 : arithVarGet(data, node);
+		return (arithVarSet(data, node,
+					arithApply(node->op, left, right, error)));
+	case ARITH_UNARY:
+		left = arithEvalNode(data, expr, node->left, error);
+		if (node->op == AOP('-', 0, 0))
+			return ((long)(0UL - (unsigned long)left));
+		if (node->op == AOP('!', 0, 0))
+			return (!left);
+		return (node->op == AOP('~', 0, 0) ? ~left : left);
+	}
+	left = arithEvalNode(data, expr, node->left, error);
+	if (node->op == AOP('&', '&', 0) || node->op == AOP('|', '|', 0))
+		return ((node->op == AOP('&', '&', 0)) ? (left
+			&& arithEvalNode(data, expr, node->right, error)) : (left
+			|| arithEvalNode(data, expr, node->right, error)));
+	right = arithEvalNode(data, expr, node->right, error);
+	return (arithApply(node->op, left, right, error));
+}
+
+/**
+ * arithLoadParams - Reads the values of the $name references of a compiled
+ * expression into their nodes.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @expr: The compiled expression.
+ *
+ * The values are read before the expression runs, as if they had been
+ * expanded into its text. That is only the same as expanding the text when
+ * each value is a plain number.
+ *
+ * Return: 1 if every value is a number without a sign, or 0 if one is not
+ * and the expression must be parsed from its expanded text instead.
+ */
+
+int arithLoadParams(data_t *data, arith_expr_t *expr)
+{
+	arith_node_t *node;
+	char *value;
+	int idx, left = expr->params;
+
+	for (idx = 0; left && idx < expr->count; idx++)
+	{
+		node = &expr->nodes[idx];
+		if (node->kind != ARITH_PARAM)
+			continue;
+		left--;
+		value = paramValue(data, node->name, node->nameLen);
+		if (!value || *value < '0' || *value > '9'
+				|| value[arithParseNumber(value, &node->value)])
+			return (0);
+	}
+	return (1);
+}
@@ -0,0 +1,184 @@
+#include "shell.h"
+
+/**
+ * findArithEnd - Finds the "))" closing an arithmetic expansion.
+ * @str: The text following "$((".
+ *
+ * Return: Index of the first closing parenthesis, or -1 if there is none.
+ */
+
+int findArithEnd(char *str)
+{
+	int idx, depth = 0;
+
+	for (idx = 0; str[idx]; idx++)
+	{
+		if (str[idx] == '(')
+			depth++;
+		else if (str[idx] == ')' && !depth && str[idx + 1] == ')')
+			return (idx);
+		else if (str[idx] == ')' && --depth < 0)
+			return (-1);
+	}
+	return (-1);
+}
+
+/**
+ * clearArithCache - Frees every compiled arithmetic expression.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: Nothing.
+ */
+
+void clearArithCache(data_t *data)
+{
+	int idx;
+
+	if (!data->arithCache)
+		return;
+	for (idx = 0; idx < ARITH_CACHE_SIZE; idx++)
+		if (data->arithCache[idx])
+		{
+			free(data->arithCache[idx]->text);
+			free(data->arithCache[idx]->nodes);
+			free(data->arithCache[idx]);
+			data->arithCache[idx] = NULL;
+		}
+	data->arithCacheCount = 0;
+}
+
+/**
+ * parseArith - Compiles an arithmetic expression into a node array.
+ * @text: The expression text (ownership passes to the result).
+ *
+ * Return: The compiled expression, whose root is -1 after a syntax error
+ * (so the error is cached too), or NULL on allocation failure.
+ */
+
+arith_expr_t *parseArith(char *text)
+{
+	arith_parser_t parser;
+	arith_expr_t *expr = malloc(sizeof(arith_expr_t));
+
+	if (!expr)
+		return (free(text), NULL);
+	fillMemWithByte((char *)expr, 0, sizeof(arith_expr_t));
+	fillMemWithByte((char *)&parser, 0, sizeof(parser));
+	expr->text = text;
+	parser.expr = expr;
+	parser.pos = text;
+	arithLex(&parser);
+	expr->root = arithParseExpr(&parser);
+	if (parser.error || expr->root < 0 || parser.tok != ARITH_TOK_END)
+	{
+		free(expr->nodes);
+		expr->nodes = NULL;
+		expr->count = expr->size = expr->params = 0;
+		expr->root = -1;
+	}
+	return (expr);
+}
+
+/**
+ * compileArith - Returns the compiled form of an arithmetic expression.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @text: The expression text (need not be NUL-terminated).
+ * @length: Length of @text.
+ *
+ * Compiled expressions are cached by their text, so the same $((...)) met
+ * again (typically in a loop body) is evaluated without being re-parsed.
+ *
+ * Return: The compiled expression (owned by the cache), or NULL on
+ * allocation failure.
+ */
+
+arith_expr_t *compileArith(data_t *data, char *text, int length)
+{
+	unsigned int slot;
+	arith_expr_t *expr;
+	char *copy;
+
+	if (data->arithCacheCount >= ARITH_CACHE_SIZE / 2)
+		clearArithCache(data);
+	if (!data->arithCache)
+	{
+		data->arithCache = malloc(sizeof(arith_expr_t *) * ARITH_CACHE_SIZE);
+		if (!data->arithCache)
+			return (NULL);
+		fillMemWithByte((char *)data->arithCache, 0,
+				sizeof(arith_expr_t *) * ARITH_CACHE_SIZE);
+	}
+	slot = hashStrN(text, length) & (ARITH_CACHE_SIZE - 1);
+	while ((expr = data->arithCache[slot]))
+	{
+		if (!cmpStrN(expr->text, text, length) && !expr->text[length])
+		{
+			STATS_ADD(data, STAT_ARITH_HITS, 1);
+			return (expr);
+		}
+		slot = (slot + 1) & (ARITH_CACHE_SIZE - 1);
+	}
+	STATS_ADD(data, STAT_ARITH_MISSES, 1);
+	copy = malloc(length + 1);
+	if (!copy)
+		return (NULL);
+	copySubstr(copy, text, length + 1);
+	expr = parseArith(copy);
+	if (expr)
+	{
+		data->arithCache[slot] = expr;
+		data->arithCacheCount++;
+	}
+	return (expr);
+}
+
+/**
+ * expandArith - Expands a $((...)) arithmetic expansion.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @str: Pointer to the '$' introducing the expansion.
+ *
+ * The expression is compiled from its source text, with $name references
+ * read as they are evaluated, so a loop such as i=$(($i + 1)) parses it
+ * once. Only when a reference is not a plain number, or the source holds
+ * other expansions, are they expanded first and the result compiled. It
+ * is evaluated with 64-bit integers and C operator precedence. A syntax
+ * error or division by zero fails the expansion (see expandError()).
+ *
+ * Return: Number of characters of @str consumed, or 0 if the expansion is
+ * not terminated.
+ */
+
+int expandArith(data_t *data, char *str)
+{
+	int end = findArithEnd(str + 3), error = 0;
+	arith_expr_t *expr;
+	char *text;
+	long value;
+
+	if (end < 0)
+		return (0);
+	expr = compileArith(data, str + 3, end);
+	if (expr && (expr->root < 0 || !arithLoadParams(data, expr)))
+	{
+		text = expandOperand(data, str + 3, end);
+		expr = text ? compileArith(data, text, strLength(text)) : NULL;
+		error = expr && (expr->root < 0 || expr->params);
+		free(text);
+	}
+	if (!expr)
+		return (0);
+	if (error)
+	{
+		expandError(data, "arithmetic syntax error\n");
+		return (end + 5);
+	}
+	value = arithEvalNode(data, expr, expr->root, &error);
+	if (error)
+		expandError(data, "division by zero\n");
+	else
+	{
+		text = convertNum(data, value, 10, 0);
+		appendExpBuf(data, text, strLength(text));
+	}
+	return (end + 5);
+}
@@ -0,0 +1,173 @@
+#include "shell.h"
+
+/**
+ * arithParseNumber - Parses a decimal, octal (0...) or hex (0x...) number.
+ * @str: The text to parse.
+ * @value: Where to store the number.
+ *
+ * Return: Number of characters consumed, or 0 if @str is not a number.
+ */
+
+int arithParseNumber(char *str, long *value)
+{
+	int idx = 0, base = 10, digit;
+	unsigned long result = 0;
+
+	if (str[0] == '0' && (str[1] == 'x' || str[1] == 'X'))
+		base = 16, idx = 2;
+	else if (str[0] == '0')
+		base = 8;
+	for (;; idx++)
+	{
+		if (str[idx] >= '0' && str[idx] <= '9')
+			digit = str[idx] - '0';
+		else if (base == 16 && isAlpha(str[idx]))
+			digit = (str[idx] | 0x20) - 'a' + 10;
+		else
+			break;
+		if (digit >= base)
+			break;
+		result = result * base + digit;
+	}
+	*value = (long)result;
+	return (base == 16 && idx == 2 ? 0 : idx);
+}
+
+/**
+ * arithLexOp - Reads the longest arithmetic operator at a position.
+ * @str: The text to read from.
+ * @length: Where to store the operator length.
+ *
+ * Return: The operator code (see AOP), or 0 if there is no operator.
+ */
+
+int arithLexOp(char *str, int *length)
+{
+	char *twoChar = "||&&==!=<=>=<<>>+=-=*=/=%=&=^=|=++--";
+	int idx;
+
+	if ((str[0] == '<' || str[0] == '>') && str[1] == str[0]
+			&& str[2] == '=')
+	{
+		*length = 3;
+		return (AOP(str[0], str[1], '='));
+	}
+	for (idx = 0; twoChar[idx]; idx += 2)
+		if (str[0] == twoChar[idx] && str[1] == twoChar[idx + 1])
+		{
+			*length = 2;
+			return (AOP(str[0], str[1], 0));
+		}
+	*length = 1;
+	if (*str && isDelim(*str, "+-*/%<>&|^!~=?:()"))
+		return (AOP(str[0], 0, 0));
+	return (0);
+}
+
+/**
+ * arithLex - Advances the arithmetic parser to the next token.
+ * @parser: The parser state.
+ *
+ * A $name or ${name} reference is one token, whose position and length
+ * are those of the name.
+ *
+ * Return: The new token (an operator code or one of the ARITH_TOK_* values).
+ */
+
+int arithLex(arith_parser_t *parser)
+{
+	int length = 0, brace;
+
+	while (isDelim(*parser->pos, " \t\n"))
+		parser->pos++;
+	parser->tokPos = parser->pos;
+	if (!*parser->pos)
+		return (parser->tok = ARITH_TOK_END);
+	if (*parser->pos >= '0' && *parser->pos <= '9')
+	{
+		length = arithParseNumber(parser->pos, &parser->tokValue);
+		parser->tok = length ? ARITH_TOK_NUM : ARITH_TOK_ERR;
+	}
+	else if (isNameChar(*parser->pos, 1))
+	{
+		while (isNameChar(parser->pos[length], 0))
+			length++;
+		parser->tok = ARITH_TOK_NAME;
+	}
+	else if (*parser->pos == '$')
+	{
+		brace = (parser->pos[1] == '{');
+		length = paramNameLen(parser->pos + 1 + brace);
+		parser->tok = (length && (!brace || parser->pos[2 + length] == '}'))
+			? ARITH_TOK_PARAM : ARITH_TOK_ERR;
+		parser->tokPos += 1 + brace;
+		parser->pos += 1 + 2 * brace;
+	}
+	else
+		parser->tok = arithLexOp(parser->pos, &length);
+	if (!parser->tok)
+		parser->tok = ARITH_TOK_ERR;
+	parser->tokLen = length;
+	parser->pos += length;
+	return (parser->tok);
+}
+
+/**
+ * arithPrec - Gives the precedence of a binary operator.
+ * @op: The operator code.
+ *
+ * Levels follow C, from || (lowest) to the multiplicative operators.
+ *
+ * Return: The precedence level, or 0 if @op is not a binary operator.
+ */
+
+int arithPrec(int op)
+{
+	switch (op)
+	{
+	case AOP('|', '|', 0):
+		return (1);
+	case AOP('&', '&', 0):
+		return (2);
+	case AOP('|', 0, 0):
+		return (3);
+	case AOP('^', 0, 0):
+		return (4);
+	case AOP('&', 0, 0):
+		return (5);
+	case AOP('=', '=', 0): case AOP('!', '=', 0):
+		return (6);
+	case AOP('<', 0, 0): case AOP('>', 0, 0):
+	case AOP('<', '=', 0): case AOP('>', '=', 0):
+		return (7);
+	case AOP('<', '<', 0): case AOP('>', '>', 0):
+		return (8);
+	case AOP('+', 0, 0): case AOP('-', 0, 0):
+		return (9);
+	case AOP('*', 0, 0): case AOP('/', 0, 0): case AOP('%', 0, 0):
+		return (10);
+	}
+	return (0);
+}
+
+/**
+ * arithAssignOp - Checks if an operator is an assignment operator.
+ * @op: The operator code.
+ *
+ * Return: The binary operator applied by a compound assignment (e.g. '+'
+ * for "+="), AOP('=', 0, 0) for plain assignment, or 0 if @op is not an
+ * assignment.
+ */
+
+int arithAssignOp(int op)
+{
+	int first = op & 0xff, second = (op >> 8) & 0xff;
+
+	if (op == AOP('=', 0, 0))
+		return (op);
+	if (op == AOP('<', '<', '=') || op == AOP('>', '>', '='))
+		return (op & 0xffff);
+	if (second == '=' && !isDelim(first, "=!<>"))
+		return (first);
+	return (0);
+}
@@ -0,0 +1,187 @@
+#include "shell.h"
+
+/**
+ * arithAddNode - Appends a node to the expression being compiled.
+ * @parser: The parser state.
+ * @kind: The node kind (ARITH_NUM, ARITH_VAR, ...).
+ * @op: The operator code, if any.
+ * @left: Index of the first operand, or -1.
+ * @right: Index of the second operand, or -1.
+ *
+ * Return: Index of the new node, or -1 on error.
+ */
+
+int arithAddNode(arith_parser_t *parser, int kind, int op, int left,
+		int right)
+{
+	arith_expr_t *expr = parser->expr;
+	arith_node_t *nodes;
+	int size;
+
+	if (left == -2 || right == -2 || parser->error)
+		return (parser->error = 1, -2);
+	if (expr->count == expr->size)
+	{
+		size = expr->size ? expr->size * 2 : 8;
+		nodes = memRealloc(expr->nodes, sizeof(arith_node_t) * expr->size,
+				sizeof(arith_node_t) * size);
+		if (!nodes)
+			return (parser->error = 1, -2);
+		expr->nodes = nodes;
+		expr->size = size;
+	}
+	fillMemWithByte((char *)&expr->nodes[expr->count], 0,
+			sizeof(arith_node_t));
+	expr->nodes[expr->count].kind = kind;
+	expr->nodes[expr->count].op = op;
+	expr->nodes[expr->count].left = left;
+	expr->nodes[expr->count].right = right;
+	expr->nodes[expr->count].cond = -1;
+	return (expr->count++);
+}
+
+/**
+ * arithParsePrimary - Parses a number, variable (with optional postfix
+ * ++/--), $name reference or parenthesised expression.
+ * @parser: The parser state.
+ *
+ * Return: Index of the parsed node, or -2 on error.
+ */
+
+int arithParsePrimary(arith_parser_t *parser)
+{
+	int node;
+
+	if (parser->tok == ARITH_TOK_NUM)
+	{
+		node = arithAddNode(parser, ARITH_NUM, 0, -1, -1);
+		if (node >= 0)
+			parser->expr->nodes[node].value = parser->tokValue;
+	}
+	else if (parser->tok == ARITH_TOK_NAME || parser->tok == ARITH_TOK_PARAM)
+	{
+		node = arithAddNode(parser, parser->tok == ARITH_TOK_NAME ? ARITH_VAR
+				: ARITH_PARAM, 0, -1, -1);
+		if (node < 0)
+			return (node);
+		parser->expr->nodes[node].name = parser->tokPos;
+		parser->expr->nodes[node].nameLen = parser->tokLen;
+		parser->expr->params += (parser->tok == ARITH_TOK_PARAM);
+		if ((arithLex(parser) == AOP('+', '+', 0)
+				|| parser->tok == AOP('-', '-', 0))
+				&& parser->expr->nodes[node].kind == ARITH_VAR)
+		{
+			parser->expr->nodes[node].kind = ARITH_POSTFIX;
+			parser->expr->nodes[node].op = parser->tok;
+			arithLex(parser);
+		}
+		return (node);
+	}
+	else if (parser->tok == AOP('(', 0, 0))
+	{
+		arithLex(parser);
+		node = arithParseExpr(parser);
+		if (parser->tok != AOP(')', 0, 0))
+			return (parser->error = 1, -2);
+	}
+	else
+		return (parser->error = 1, -2);
+	arithLex(parser);
+	return (node);
+}
+
+/**
+ * arithParseUnary - Parses prefix operators and their operand.
+ * @parser: The parser state.
+ *
+ * Return: Index of the parsed node, or -2 on error.
+ */
+
+int arithParseUnary(arith_parser_t *parser)
+{
+	int op = parser->tok, node;
+
+	if (op == AOP('+', '+', 0) || op == AOP('-', '-', 0))
+	{
+		if (arithLex(parser) != ARITH_TOK_NAME)
+			return (parser->error = 1, -2);
+		node = arithParsePrimary(parser);
+		if (node >= 0 && parser->expr->nodes[node].kind == ARITH_VAR)
+		{
+			parser->expr->nodes[node].kind = ARITH_PREFIX;
+			parser->expr->nodes[node].op = op;
+			return (node);
+		}
+		return (parser->error = 1, -2);
+	}
+	if (op == AOP('+', 0, 0) || op == AOP('-', 0, 0)
+			|| op == AOP('!', 0, 0) || op == AOP('~', 0, 0))
+	{
+		arithLex(parser);
+		node = arithParseUnary(parser);
+		return (arithAddNode(parser, ARITH_UNARY, op, node, -1));
+	}
+	return (arithParsePrimary(parser));
+}
+
+/**
+ * arithParseBinary - Parses binary operators by precedence climbing.
+ * @parser: The parser state.
+ * @minPrec: The lowest precedence level this call may consume.
+ *
+ * Return: Index of the parsed node, or -2 on error.
+ */
+
+int arithParseBinary(arith_parser_t *parser, int minPrec)
+{
+	int left, right, op, prec;
+
+	left = arithParseUnary(parser);
+	while ((prec = arithPrec(parser->tok)) && prec >= minPrec)
+	{
+		op = parser->tok;
+		arithLex(parser);
+		right = arithParseBinary(parser, prec + 1);
+		left = arithAddNode(parser, ARITH_BINARY, op, left, right);
+	}
+	return (left);
+}
+
+/**
+ * arithParseExpr - Parses a full expression, including ?: and the
+ * (right-associative) assignment operators.
+ * @parser: The parser state.
+ *
+ * Return: Index of the parsed node, or -2 on error.
+ */
+
+int arithParseExpr(arith_parser_t *parser)
+{
+	int node, op, left, right;
+
+	node = arithParseBinary(parser, 1);
+	if (parser->tok == AOP('?', 0, 0))
+	{
+		arithLex(parser);
+		left = arithParseExpr(parser);
+		if (parser->tok != AOP(':', 0, 0))
+			return (parser->error = 1, -2);
+		arithLex(parser);
+		right = arithParseExpr(parser);
+		op = arithAddNode(parser, ARITH_TERNARY, 0, left, right);
+		if (op >= 0)
+			parser->expr->nodes[op].cond = node;
+		return (op);
+	}
+	op = arithAssignOp(parser->tok);
+	if (!op)
+		return (node);
+	if (node < 0 || parser->expr->nodes[node].kind != ARITH_VAR)
+		return (parser->error = 1, -2);
+	arithLex(parser);
+	right = arithParseExpr(parser);
+	parser->expr->nodes[node].kind = ARITH_ASSIGN;
+	parser->expr->nodes[node].op = op;
+	parser->expr->nodes[node].right = right;
+	return (right < 0 ? -2 : node);
+}
@@ -0,0 +1,74 @@
+/* Generated by tools/gen_builtin_hash.c - do not edit. */
+#ifndef BUILTIN_HASH_H
+#define BUILTIN_HASH_H
+
+#define BUILTIN_HASH_SEED 2313U
+#define BUILTIN_TABLE_SIZE 64
+
+#define BUILTIN_TABLE_ENTRIES \
+	{"false", falseCmd, BUILTIN_PURE}, \
+	{NULL, NULL, 0}, \
+	{"exit", exitShell, BUILTIN_SUBSHELL}, \
+	{NULL, NULL, 0}, \
+	{"pwd", pwdCmd, BUILTIN_PURE}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{":", trueCmd, BUILTIN_PURE}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{"test", testCmd, BUILTIN_PURE}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{"shift", shiftCmd, BUILTIN_SUBSHELL}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{"true", trueCmd, BUILTIN_PURE}, \
+	{"[", testCmd, BUILTIN_PURE}, \
+	{"return", returnCmd, BUILTIN_SUBSHELL}, \
+	{"cd", changeDir, BUILTIN_SUBSHELL}, \
+	{NULL, NULL, 0}, \
+	{"alias", manageAlias, BUILTIN_SUBSHELL}, \
+	{"type", typeCmd, BUILTIN_PURE}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{"parallel", parallelCmd, 0}, \
+	{NULL, NULL, 0}, \
+	{"setenv", initEnvironVar, BUILTIN_SUBSHELL}, \
+	{"unsetenv", rmvEnvironVar, BUILTIN_SUBSHELL}, \
+	{NULL, NULL, 0}, \
+	{"env", displayEnv, BUILTIN_PURE}, \
+	{"break", breakCmd, BUILTIN_SUBSHELL}, \
+	{"stats", statsCmd, 0}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{".", sourceCmd, 0}, \
+	{NULL, NULL, 0}, \
+	{"history", dispHistory, BUILTIN_PURE}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{"local", localCmd, 0}, \
+	{NULL, NULL, 0}, \
+	{"which", whichCmd, BUILTIN_PURE}, \
+	{NULL, NULL, 0}, \
+	{"echo", echoCmd, BUILTIN_PURE}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{"continue", continueCmd, BUILTIN_SUBSHELL}, \
+	{"help", dispHelp, BUILTIN_PURE}, \
+	{NULL, NULL, 0}, \
+	{NULL, NULL, 0}, \
+	{"set", setCmd, 0}, \
+	{"read", readCmd, 0}, \
+	{"command", commandCmd, 0}, \
+	{NULL, NULL, 0}, \
+	{"source", sourceCmd, 0}
+
+#endif /* BUILTIN_HASH_H */
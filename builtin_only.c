@@ -0,0 +1,71 @@
+#include "shell.h"
+
+/**
+ * isBuiltinCmd - Checks if a simple command runs a builtin with the given
+ * properties.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The command node.
+ * @flags: The BUILTIN_* flags, any of which the builtin must have.
+ *
+ * With BUILTIN_SUBSHELL the command runs against a snapshot, so leading
+ * assignments and expansions in the arguments are allowed; only the
+ * command name must be plain. Otherwise no word may be expanded.
+ *
+ * Return: 1 if the command may run in-process, 0 otherwise.
+ */
+
+int isBuiltinCmd(data_t *data, node_t *node, int flags)
+{
+	resolved_t cmd;
+	int idx, first = 0;
+
+	if (flags & BUILTIN_SUBSHELL)
+		while (first < node->count && isAssignment(node->words[first]))
+			first++;
+	if (first == node->count)
+		return (1);
+	for (idx = first; idx < node->count; idx++)
+		if ((idx == first || !(flags & BUILTIN_SUBSHELL))
+				&& (findChar(node->words[idx], '$')
+					|| findChar(node->words[idx], '`')))
+			return (0);
+	return (!isAssignment(node->words[first])
+			&& resolveCommand(data, node->words[first], 0, &cmd) == CMD_BUILTIN
+			&& (cmd.builtin->flags & flags));
+}
+
+/**
+ * isBuiltinOnly - Checks if a command tree only runs builtins with the
+ * given properties.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The tree.
+ * @flags: The BUILTIN_* flags, any of which each builtin must have.
+ *
+ * Only lists, and-or lists, "!", groups and if statements are looked
+ * into, and with BUILTIN_SUBSHELL also pipelines and subshells. Loops,
+ * case statements and redirected commands are left to a child process, so
+ * what runs in-process always finishes and writes a bounded amount.
+ *
+ * Return: 1 if the tree can safely run inside the shell process, else 0.
+ */
+
+int isBuiltinOnly(data_t *data, node_t *node, int flags)
+{
+	int type;
+
+	if (!node)
+		return (1);
+	if (node->redirs)
+		return (0);
+	type = node->type;
+	if (type == NODE_CMD)
+		return (isBuiltinCmd(data, node, flags));
+	if (type != NODE_LIST && type != NODE_AND && type != NODE_OR
+			&& type != NODE_NOT && type != NODE_GROUP && type != NODE_IF
+			&& ((type != NODE_PIPE && type != NODE_SUBSHELL)
+				|| !(flags & BUILTIN_SUBSHELL)))
+		return (0);
+	return (isBuiltinOnly(data, node->left, flags)
+			&& isBuiltinOnly(data, node->right, flags)
+			&& (type != NODE_IF || isBuiltinOnly(data, node->next, flags)));
+}
@@ -0,0 +1,53 @@
+#include "shell.h"
+#include "builtin_hash.h"
+
+/*
+ * The table is laid out by tools/gen_builtin_hash.c so that every builtin
+ * name hashes to its own slot. Regenerate builtin_hash.h whenever
+ * tools/builtins.list changes.
+ */
+static const BuiltinCommand builtinTable[BUILTIN_TABLE_SIZE] = {
+	BUILTIN_TABLE_ENTRIES
+};
+
+/**
+ * hashBuiltinName - Hashes a command name into the builtin table.
+ * @name: The command name to hash.
+ *
+ * This function computes the seeded FNV-1a hash that the generator used to
+ * lay out the builtin table.
+ *
+ * Return: The hash value.
+ */
+
+unsigned int hashBuiltinName(const char *name)
+{
+	unsigned int hash = BUILTIN_HASH_SEED;
+
+	while (*name)
+		hash = BUILTIN_HASH_STEP(hash, (unsigned char)*name++);
+	return (BUILTIN_HASH_FINAL(hash));
+}
+
+/**
+ * findBuiltin - Looks up a builtin command by name.
+ * @name: The command name to look up.
+ *
+ * This function resolves @name with a single hash and at most one string
+ * comparison against the perfect-hash builtin table.
+ *
+ * Return: Pointer to the matching table entry, or NULL if @name is not a
+ * builtin.
+ */
+
+const BuiltinCommand *findBuiltin(char *name)
+{
+	const BuiltinCommand *entry;
+
+	if (!name)
+		return (NULL);
+	entry = &builtinTable[hashBuiltinName(name) & (BUILTIN_TABLE_SIZE - 1)];
+	if (entry->command && cmpStr(name, entry->command) == 0)
+		return (entry);
+	return (NULL);
+}
@@ -0,0 +1,68 @@
+#include "shell.h"
+
+/**
+ * saveCmdState - Saves the state of the command being run, so that another
+ * command line can be run in-process in the middle of it.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @state: Where to save the state.
+ *
+ * The expansion buffer is moved out as well, since the nested command
+ * expands its own words.
+ *
+ * Return: Nothing.
+ */
+
+void saveCmdState(data_t *data, cmd_state_t *state)
+{
+	state->argv = data->argv;
+	state->argc = data->argc;
+	state->commandPath = data->commandPath;
+	state->lineCounter = data->lineCounter;
+	state->exp = data->exp;
+	state->expSplit = data->expSplit;
+	state->expQuoted = data->expQuoted;
+	clearShellData(data);
+	fillMemWithByte((char *)&data->exp, 0, sizeof(data->exp));
+}
+
+/**
+ * restoreCmdState - Restores the state saved by saveCmdState().
+ * @data: Pointer to the data_t struct containing shell information.
+ * @state: The saved state.
+ *
+ * Return: Nothing.
+ */
+
+void restoreCmdState(data_t *data, cmd_state_t *state)
+{
+	free(data->exp.buf);
+	data->argv = state->argv;
+	data->argc = state->argc;
+	data->commandPath = state->commandPath;
+	data->lineCounter = state->lineCounter;
+	data->exp = state->exp;
+	data->expSplit = state->expSplit;
+	data->expQuoted = state->expQuoted;
+}
+
+/**
+ * evalCmdLine - Parses and runs a command line.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @line: The command line.
+ *
+ * Return: -2 if a command asked the shell to exit, otherwise 0.
+ */
+
+int evalCmdLine(data_t *data, char *line)
+{
+	program_t *prog;
+	int status = parseProgram(data, line, data->lineCounter, &prog);
+
+	if (status == PARSE_INCOMPLETE)
+		printSyntaxErr(data, data->lineCounter, NULL);
+	if (status != PARSE_OK)
+		return (0);
+	execProgram(data, prog);
+	releaseProgram(prog);
+	return (data->unwind == UNWIND_EXIT ? -2 : 0);
+}
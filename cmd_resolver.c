@@ -0,0 +1,149 @@
+#include "shell.h"
+
+/**
+ * clearCmdCache - Drops every cached command resolution.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * This function is called whenever the alias list, PATH or the function
+ * table changes, since any cached answer may then be stale.
+ *
+ * Return: Nothing.
+ */
+
+void clearCmdCache(data_t *data)
+{
+	int idx;
+
+	if (!data->cmdCache)
+		return;
+	for (idx = 0; idx < CMD_CACHE_SIZE; idx++)
+	{
+		free(data->cmdCache[idx].name);
+		free(data->cmdCache[idx].path);
+	}
+	fillMemWithByte((char *)data->cmdCache, 0,
+			sizeof(cmd_cache_t) * CMD_CACHE_SIZE);
+	data->cmdCacheCount = 0;
+}
+
+/**
+ * findCacheSlot - Finds the cache slot holding, or able to hold, a name.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @name: The command name.
+ *
+ * Return: Pointer to the slot, or NULL if the cache is not allocated.
+ */
+
+cmd_cache_t *findCacheSlot(data_t *data, char *name)
+{
+	unsigned int idx;
+
+	if (!data->cmdCache)
+	{
+		data->cmdCache = malloc(sizeof(cmd_cache_t) * CMD_CACHE_SIZE);
+		if (!data->cmdCache)
+			return (NULL);
+		fillMemWithByte((char *)data->cmdCache, 0,
+				sizeof(cmd_cache_t) * CMD_CACHE_SIZE);
+	}
+	idx = hashStrN(name, strLength(name)) & (CMD_CACHE_SIZE - 1);
+	while (data->cmdCache[idx].name && cmpStr(data->cmdCache[idx].name, name))
+		idx = (idx + 1) & (CMD_CACHE_SIZE - 1);
+	return (&data->cmdCache[idx]);
+}
+
+/**
+ * fillCacheSlot - Resolves a name by scanning each source and caches it.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @slot: The empty cache slot for @name.
+ * @name: The command name.
+ *
+ * Both the alias (if any) and what the name means without the alias are
+ * stored, so callers that already expanded aliases can share the entry.
+ * A function hides a builtin or executable of the same name, but they are
+ * stored as well for the command built-in, which bypasses functions.
+ *
+ * Return: 1 if something was found and cached, 0 otherwise.
+ */
+
+int fillCacheSlot(data_t *data, cmd_cache_t *slot, char *name)
+{
+	item_t *aliasNode;
+
+	aliasNode = findNodeWithPrefix(data->aliasList, name, '=');
+	if (aliasNode)
+		slot->aliasValue = findChar(aliasNode->string, '=') + 1;
+	slot->func = findFunc(data, name);
+	slot->builtin = findBuiltin(name);
+	if (!slot->builtin)
+		slot->path = dupStr(findCmdInPath(data,
+					getEnvironVar(data, "PATH="), name));
+	if (slot->func)
+		slot->type = CMD_FUNCTION;
+	else if (slot->builtin)
+		slot->type = CMD_BUILTIN;
+	else
+		slot->type = slot->path ? CMD_FILE : CMD_NOT_FOUND;
+	if (!slot->aliasValue && slot->type == CMD_NOT_FOUND)
+		return (0);
+	slot->name = dupStr(name);
+	STATS_ADD(data, STAT_ALLOCS, slot->path ? 2 : 1);
+	if (!slot->name)
+	{
+		free(slot->path);
+		fillMemWithByte((char *)slot, 0, sizeof(*slot));
+		return (0);
+	}
+	data->cmdCacheCount++;
+	return (1);
+}
+
+/**
+ * resolveCommand - Resolves a command name to an alias, builtin, function
+ * or executable file.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @name: The command name to resolve.
+ * @skipAlias: True to ignore aliases (the name was already expanded).
+ * @result: Where to store the tagged resolution.
+ *
+ * This function is the single place where command names are resolved. Found
+ * names are remembered in a small per-shell cache, so repeated lookups of the
+ * same name cost one hash probe instead of a walk over every PATH directory.
+ * Strings in @result are owned by the cache and stay valid until the cache
+ * is cleared.
+ *
+ * Return: The resolved command type (CMD_*).
+ */
+
+int resolveCommand(data_t *data, char *name, int skipAlias,
+		resolved_t *result)
+{
+	cmd_cache_t *slot;
+	long start = STATS_BEGIN(data);
+
+	fillMemWithByte((char *)result, 0, sizeof(*result));
+	if (!name || !*name)
+		return (CMD_NOT_FOUND);
+	if (data->cmdCacheCount >= CMD_CACHE_SIZE / 2)
+		clearCmdCache(data);
+	slot = findCacheSlot(data, name);
+	if (slot)
+		STATS_ADD(data, slot->name ? STAT_CMD_HITS
+				: STAT_CMD_MISSES, 1);
+	if (!slot || (!slot->name && !fillCacheSlot(data, slot, name)))
+		result->type = CMD_NOT_FOUND;
+	else if (slot->aliasValue && !skipAlias)
+	{
+		result->value = slot->aliasValue;
+		result->type = CMD_ALIAS;
+	}
+	else
+	{
+		result->type = slot->type;
+		result->builtin = slot->builtin;
+		result->path = slot->path;
+		result->func = slot->func;
+	}
+	STATS_END(data, PHASE_RESOLVE, start);
+	return (result->type);
+}
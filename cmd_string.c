@@ -0,0 +1,90 @@
+#include "shell.h"
+
+/**
+ * tailCommand - Finds the simple command a program ends with.
+ * @node: The program's tree.
+ *
+ * Only lists and the right side of && and || are followed: when the
+ * command found runs, nothing in the program runs after it.
+ *
+ * Return: The command's node, or NULL if the program ends with anything
+ * else.
+ */
+
+node_t *tailCommand(node_t *node)
+{
+	while (node)
+	{
+		if (node->type == NODE_LIST)
+			node = node->right ? node->right : node->left;
+		else if (node->type == NODE_AND || node->type == NODE_OR)
+			node = node->right;
+		else
+			return (node->type == NODE_CMD ? node : NULL);
+	}
+	return (NULL);
+}
+
+/**
+ * execInPlace - Replaces the shell with the external command it runs last.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: Nothing; it only returns if execve() fails, with the exit status
+ * a forked child would have had.
+ */
+
+void execInPlace(data_t *data)
+{
+	data->execTail = 0;
+	printErrChar(data, FLUSH_BUFFER_FLAG);
+	execve(data->commandPath, data->argv, getEnv(data));
+	data->execStat = (errno == EACCES) ? 126 : 1;
+}
+
+/**
+ * runCmdString - Runs a command string ("hsh -c 'cmdline' [name [args...]]").
+ * @data: Pointer to the data_t struct containing shell information.
+ * @argv: The command string, then optionally the name used in messages
+ * and the positional parameters.
+ *
+ * The string is parsed as a whole. If it ends with an external command,
+ * the shell execs it instead of forking, so its exit status reaches the
+ * caller directly, unless a metrics file must be written at exit.
+ *
+ * Return: The exit status of the string (2 after a syntax error).
+ */
+
+int runCmdString(data_t *data, char **argv)
+{
+	program_t *prog;
+	int status;
+
+	if (argv[1])
+	{
+		data->fName = argv[1];
+		data->posArgs = argv + 2;
+		for (data->posCount = 0; data->posArgs[data->posCount];)
+			data->posCount++;
+	}
+	data->lineCounter = data->inputLine = 1;
+	status = parseProgram(data, argv[0], 1, &prog);
+	if (status == PARSE_INCOMPLETE)
+		printSyntaxErr(data, 1, NULL);
+	if (status == PARSE_OK)
+	{
+		if (!data->metrics.path)
+			data->tailCmd = tailCommand(prog->root);
+		execProgram(data, prog);
+		releaseProgram(prog);
+	}
+	else
+		data->execStat = 2;
+	if (data->unwind == UNWIND_EXIT && data->errorCode != -1)
+		data->execStat = data->errorCode;
+	putChar(data, FLUSH_BUFFER_FLAG);
+	printErrChar(data, FLUSH_BUFFER_FLAG);
+	status = data->execStat;
+	writeMetrics(data);
+	freeShellData(data, 1);
+	return (status);
+}
@@ -0,0 +1,180 @@
+#include "shell.h"
+
+/**
+ * findSubstEnd - Finds the end of a command substitution.
+ * @str: The text following "$(" or the opening backquote.
+ * @backquote: True for `...` substitutions.
+ *
+ * Parentheses inside quotes in a $(...) substitution are not counted.
+ *
+ * Return: Index of the closing ')' or backquote, or -1 if there is none.
+ */
+
+int findSubstEnd(char *str, int backquote)
+{
+	int idx, depth = 0, quote = 0;
+
+	for (idx = 0; str[idx]; idx++)
+	{
+		if (str[idx] == '\\' && str[idx + 1] && quote != '\'')
+			idx++;
+		else if (quote)
+			quote = (str[idx] == quote) ? 0 : quote;
+		else if (!backquote && (str[idx] == '\'' || str[idx] == '"'))
+			quote = str[idx];
+		else if (backquote && str[idx] == '`')
+			return (idx);
+		else if (!backquote && str[idx] == '(')
+			depth++;
+		else if (!backquote && str[idx] == ')' && !depth--)
+			return (idx);
+	}
+	return (-1);
+}
+
+/**
+ * captureFromChild - Runs a program in a child process and collects its
+ * standard output through a pipe.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @prog: The parsed program.
+ * @out: The buffer to append the output to.
+ *
+ * Return: Nothing. @data->execStat is set to the child's exit status, or
+ * to 2 if the pipe or the child could not be created.
+ */
+
+void captureFromChild(data_t *data, program_t *prog, strbuf_t *out)
+{
+	int pipeFds[2], stdio[3] = {-1, -1, -1};
+	char buffer[READ_BUFFER_SIZE];
+	ssize_t bytes;
+	pid_t pid = 0;
+	long start = STATS_BEGIN(data);
+
+	putChar(data, FLUSH_BUFFER_FLAG);
+	printErrChar(data, FLUSH_BUFFER_FLAG);
+	traceChar(data, FLUSH_BUFFER_FLAG);
+	if (pipe(pipeFds) == -1 || (pid = fork()) == -1)
+	{
+		perror("Error:");
+		if (pid == -1)
+			close(pipeFds[0]), close(pipeFds[1]);
+		data->execStat = 2;
+		return;
+	}
+	STATS_END(data, PHASE_SPAWN, start);
+	STATS_ADD(data, STAT_SYSCALLS, 2);
+	if (pid == 0)
+	{
+		close(pipeFds[0]);
+		stdio[1] = pipeFds[1];
+		detachSink(data, stdio);
+		setOutputCapture(data, NULL);
+		execProgram(data, prog);
+		exitChild(data);
+	}
+	close(pipeFds[1]);
+	while ((bytes = read(pipeFds[0], buffer, READ_BUFFER_SIZE)) > 0)
+		appendStrBuf(out, buffer, bytes);
+	close(pipeFds[0]);
+	data->execStat = waitChild(data, pid);
+}
+
+/**
+ * captureOutput - Runs a command line and collects its standard output.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @line: The command line.
+ * @out: The buffer to append the output to.
+ *
+ * Lines made only of builtins, such as $(pwd) or $(cd dir && pwd), run
+ * in-process as a subshell with their output captured in memory. Anything
+ * else runs in a child process.
+ *
+ * Return: Nothing.
+ */
+
+void captureOutput(data_t *data, char *line, strbuf_t *out)
+{
+	cmd_state_t state;
+	program_t *prog;
+	int status = parseProgram(data, line, data->lineCounter, &prog);
+
+	if (status == PARSE_INCOMPLETE)
+		printSyntaxErr(data, data->lineCounter, NULL);
+	if (status != PARSE_OK)
+		return;
+	if (!isBuiltinOnly(data, prog->root, BUILTIN_PURE | BUILTIN_SUBSHELL))
+	{
+		captureFromChild(data, prog, out);
+		releaseProgram(prog);
+		return;
+	}
+	saveCmdState(data, &state);
+	runSubshell(data, prog->root, out);
+	restoreCmdState(data, &state);
+	releaseProgram(prog);
+}
+
+/**
+ * unescapeBackquoted - Removes the backslashes quoting $, ` and \ in the
+ * text of a `...` substitution.
+ * @text: The text, changed in place.
+ * @dquoted: True if the substitution is inside double quotes, where \" is
+ * unescaped as well.
+ *
+ * Return: Nothing.
+ */
+
+void unescapeBackquoted(char *text, int dquoted)
+{
+	char *out = text;
+
+	for (; *text; text++)
+	{
+		if (*text == '\\' && (isDelim(text[1], "$`\\")
+					|| (dquoted && text[1] == '"')))
+			text++;
+		*out++ = *text;
+	}
+	*out = '\0';
+}
+
+/**
+ * expandCmdSubst - Expands a $(...) or `...` command substitution.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @str: Pointer to the '$' or backquote introducing the substitution.
+ *
+ * The text of a `...` substitution is unescaped before it is parsed.
+ * Trailing newlines are removed from the output; unless the substitution
+ * is inside double quotes, the characters of IFS inside it are marked as
+ * field separators for word splitting.
+ *
+ * Return: Number of characters of @str consumed, or 0 if the substitution
+ * is not terminated.
+ */
+
+int expandCmdSubst(data_t *data, char *str)
+{
+	int backquote = (*str == '`'), end;
+	char *start = str + (backquote ? 1 : 2), *line;
+	strbuf_t out = {NULL, 0, 0};
+	size_t base = data->exp.len;
+
+	end = findSubstEnd(start, backquote);
+	if (end < 0)
+		return (0);
+	line = malloc(end + 1);
+	if (!line)
+		return (0);
+	copySubstr(line, start, end + 1);
+	if (backquote)
+		unescapeBackquoted(line, data->expQuoted & 2);
+	captureOutput(data, line, &out);
+	free(line);
+	while (out.len && out.buf[out.len - 1] == '\n')
+		out.len--;
+	appendExpBuf(data, out.buf ? out.buf : "", out.len);
+	free(out.buf);
+	markFields(data, base);
+	return (end + (backquote ? 2 : 3));
+}
@@ -3,6 +3,7 @@
 /**
  * copyCharacters - Copies characters from a source string.
  *
+ * @buffer: The buffer to copy into, large enough for the substring.
  * @source: The source string.
  * @subStrBegin: The beginning index of the substring.
  * @subStrEnd: The ending index of the substring.
@@ -10,14 +11,14 @@
  * This function extracts characters from the source string within the
  * specified range, excluding colons.
  *
- * Return: Pointer to the new buffer containing the copied substring.
+ * Return: @buffer, holding the copied substring.
  */
 
-char *copyCharacters(char *source, int subStrBegin, int subStrEnd)
+char *copyCharacters(char *buffer, char *source, int subStrBegin,
+		int subStrEnd)
 {
 	int srcIndex = 0;
 	int bufIndex = 0;
-	static char buffer[1024];
 
 	for (srcIndex = subStrBegin; srcIndex < subStrEnd; srcIndex++)
 	{
@@ -35,14 +36,17 @@ char *copyCharacters(char *source, int subStrBegin, int subStrEnd)
 
 /**
  * findCmdInPath - Finds the full path of a command in the PATH environment.
- * @data: Pointer to the data struct (UNUSED).
+ * @data: Pointer to the data struct, which holds the path returned.
  * @pathEnv: The PATH string containing directories separated by colons.
  * @cmdName: The command to find.
  *
  * This function searches for the full path of a command within directories
- * listed in the PATH environment variable.
+ * listed in the PATH environment variable. Directories whose full path
+ * would not fit in @data->pathBuf are skipped. A name containing a slash
+ * is not searched for; it is checked as it is.
  *
- * Return: Full path of the command if found, or NULL if not found.
+ * Return: Full path of the command if found (valid until the next call),
+ * or NULL if not found.
  */
 
 char *findCmdInPath(data_t *data, char *pathEnv, char *cmdName)
@@ -51,34 +55,26 @@ char *findCmdInPath(data_t *data, char *pathEnv, char *cmdName)
 	int partStrt = 0;
 	char *path;
 
-	(void)data;
-
+	if (findChar(cmdName, '/'))
+		return (isBuiltinCommand(data, cmdName) ? cmdName : NULL);
 	if (!pathEnv)
 		return (NULL);
 
-	if ((strLength(cmdName) > 2) && findPrefix(cmdName, "./"))
-	{
-		if (isBuiltinCommand(data, cmdName))
-			return (cmdName);
-	}
-
 	while (1)
 	{
 		if (!pathEnv[pathIdx] || pathEnv[pathIdx] == ':')
 		{
-			path = copyCharacters(pathEnv, partStrt, pathIdx);
-
-			if (!*path)
-				concatStr(path, cmdName);
-			else
+			path = data->pathBuf;
+			if (pathIdx - partStrt + strLength(cmdName) + 2 <= PATH_BUFFER_SIZE)
 			{
-				concatStr(path, "/");
+				copyCharacters(path, pathEnv, partStrt, pathIdx);
+				if (*path)
+					concatStr(path, "/");
 				concatStr(path, cmdName);
+				if (isBuiltinCommand(data, path))
+					return (path);
 			}
 
-			if (isBuiltinCommand(data, path))
-				return (path);
-
 			if (!pathEnv[pathIdx])
 				break;
 			partStrt = pathIdx;
@@ -91,7 +87,7 @@ char *findCmdInPath(data_t *data, char *pathEnv, char *cmdName)
 
 /**
  * isBuiltinCommand - Checks if a given command is a built-in command.
- * @data: Pointer to the data struct (UNUSED).
+ * @data: Pointer to the data struct, for the stats built-in.
  * @command: The command to check.
  *
  * This function checks whether a given command is an external executable file
@@ -104,9 +100,10 @@ int isBuiltinCommand(data_t *data, char *command)
 {
 	struct stat fileStat;
 
-	(void)data;
-
-	if (!command || stat(command, &fileStat))
+	if (!command)
+		return (0);
+	STATS_ADD(data, STAT_SYSCALLS, 1);
+	if (stat(command, &fileStat))
 		return (0);
 
 	if (fileStat.st_mode & S_IFREG)
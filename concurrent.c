@@ -0,0 +1,167 @@
+#include "shell.h"
+
+/**
+ * scheduleSteps - Starts the steps of a concurrent block that are ready,
+ * as far as there are free slots, and skips those that can no longer run.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @steps: The steps.
+ * @deps: The dependency array.
+ * @count: Number of steps.
+ * @jobs: The job slots.
+ * @slots: Number of slots.
+ *
+ * Each step runs in a child with its standard input from /dev/null, like
+ * a background command.
+ *
+ * Return: Number of steps started or skipped.
+ */
+
+int scheduleSteps(data_t *data, step_t *steps, int *deps, int count,
+		par_job_t *jobs, int slots)
+{
+	int idx, slot = 0, changed = 0, ready, null;
+	pid_t pid;
+
+	for (idx = 0; idx < count; idx++)
+	{
+		ready = (steps[idx].state == STEP_PENDING)
+			? stepReady(steps, deps, idx) : STEP_PENDING;
+		if (ready == STEP_SKIPPED)
+			steps[idx].state = STEP_SKIPPED, changed++;
+		while (ready == STEP_READY && slot < slots && jobs[slot].tag != -1)
+			slot++;
+		if (ready != STEP_READY || slot == slots)
+			continue;
+		steps[idx].state = STEP_RUNNING;
+		jobs[slot].tag = idx, changed++;
+		pid = forkJob(data, jobs + slot);
+		if (pid == 0)
+		{
+			null = open("/dev/null", O_RDONLY);
+			if (null > STDIN_FILENO)
+				dup2(null, STDIN_FILENO), close(null);
+			data->stdinRedirs++;
+			execNode(data, steps[idx].node->left);
+			exitChild(data);
+		}
+		if (pid == -1)
+			perror("Error:"), jobs[slot].status = 1;
+	}
+	return (changed);
+}
+
+/**
+ * reapSteps - Records the result of the steps whose jobs have finished.
+ * @steps: The steps.
+ * @jobs: The job slots.
+ * @slots: Number of slots.
+ * @status: Set to the exit status of each step that fails.
+ *
+ * Return: Nothing.
+ */
+
+void reapSteps(step_t *steps, par_job_t *jobs, int slots, int *status)
+{
+	int idx;
+
+	for (idx = 0; idx < slots; idx++)
+	{
+		if (jobs[idx].pid || jobs[idx].tag == -1)
+			continue;
+		steps[jobs[idx].tag].state = jobs[idx].status ? STEP_FAILED
+			: STEP_DONE;
+		if (jobs[idx].status)
+			*status = jobs[idx].status;
+		jobs[idx].tag = -1;
+	}
+}
+
+/**
+ * runSteps - Runs the steps of a concurrent block until none can run.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @steps: The steps.
+ * @deps: The dependency array.
+ * @count: Number of steps.
+ * @jobs: The free job slots.
+ * @slots: Number of slots.
+ *
+ * A step starts as soon as every step it runs after has succeeded, and is
+ * skipped as soon as one of them fails or is skipped.
+ *
+ * Return: The exit status of the last step to fail, 2 if the steps wait
+ * on each other in a cycle, else 0.
+ */
+
+int runSteps(data_t *data, step_t *steps, int *deps, int count,
+		par_job_t *jobs, int slots)
+{
+	struct pollfd *polls = malloc(sizeof(struct pollfd) * 2 * slots);
+	int changed = 1, running = 0, failed = 0, status = 0, idx;
+
+	if (!polls)
+		return (1);
+	while (changed || running)
+	{
+		changed = scheduleSteps(data, steps, deps, count, jobs, slots);
+		for (running = 0, idx = 0; idx < slots; idx++)
+			running += (jobs[idx].pid != 0);
+		if (running)
+			collectOutput(jobs, polls, slots);
+		finishJobs(data, jobs, slots, &failed);
+		reapSteps(steps, jobs, slots, &status);
+	}
+	free(polls);
+	for (idx = 0; idx < count; idx++)
+		if (steps[idx].state == STEP_PENDING)
+		{
+			printShellErr(data, "concurrent: dependency cycle at ");
+			printErrStr(data, steps[idx].node->name);
+			printErrChar(data, '\n');
+			return (2);
+		}
+	return (status);
+}
+
+/**
+ * execConcurrent - Runs a "concurrent [-j N] { steps }" block.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The NODE_CONCURRENT.
+ *
+ * Steps with no "after:" list run at once, up to the job limit (one job per
+ * online processor by default). Each step runs in a child process, so
+ * variables it sets are not seen by the shell, and its output is printed
+ * in one piece when it finishes.
+ *
+ * Return: Nothing.
+ */
+
+void execConcurrent(data_t *data, node_t *node)
+{
+	step_t *steps = NULL;
+	par_job_t *jobs = NULL;
+	int *deps = NULL, count, slots = node->count, idx;
+
+	data->lineCounter = node->line;
+	count = buildSteps(data, node, &steps, &deps);
+	if (!slots)
+		slots = sysconf(_SC_NPROCESSORS_ONLN);
+	if (slots < 1 || slots > count)
+		slots = (count > 0) ? count : 1;
+	if (count > 0)
+		jobs = malloc(sizeof(par_job_t) * slots);
+	data->execStat = 2;
+	if (jobs)
+	{
+		fillMemWithByte((char *)jobs, 0, sizeof(par_job_t) * slots);
+		for (idx = 0; idx < slots; idx++)
+			jobs[idx].tag = -1;
+		putChar(data, FLUSH_BUFFER_FLAG);
+		printErrChar(data, FLUSH_BUFFER_FLAG);
+		data->execStat = runSteps(data, steps, deps, count, jobs, slots);
+		for (idx = 0; idx < slots; idx++)
+			free(jobs[idx].out.buf), free(jobs[idx].err.buf);
+	}
+	free(jobs);
+	free(steps);
+	free(deps);
+}
@@ -0,0 +1,119 @@
+#include "shell.h"
+
+/**
+ * findStep - Finds a step of a concurrent block by name.
+ * @step: The first step of the block.
+ * @name: The name.
+ *
+ * Return: The index of the first step with that name, or -1 if none has.
+ */
+
+int findStep(node_t *step, char *name)
+{
+	int idx;
+
+	for (idx = 0; step; step = step->next, idx++)
+		if (step->name && !cmpStr(step->name, name))
+			return (idx);
+	return (-1);
+}
+
+/**
+ * stepLabel - Gives the label a concurrent step was written with.
+ * @step: The NODE_STEP.
+ *
+ * Return: The label, or NULL if the step is named after the first word of
+ * its first command.
+ */
+
+char *stepLabel(node_t *step)
+{
+	node_t *cmd = step->left;
+
+	while (cmd && cmd->type != NODE_CMD && cmd->left)
+		cmd = cmd->left;
+	if (cmd && cmd->type == NODE_CMD && cmd->count
+			&& step->name == cmd->words[0])
+		return (NULL);
+	return (step->name);
+}
+
+/**
+ * buildSteps - Sets up the steps of a concurrent block to run.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The NODE_CONCURRENT.
+ * @steps: Set to the array of steps.
+ * @deps: Set to the array of dependencies, as step indices.
+ *
+ * The names each step runs after are looked up once here, so the
+ * scheduler only compares states. A label another step's name repeats, or
+ * a name no step has, is an error.
+ *
+ * Return: The number of steps, or -1 on error (the arrays are still set
+ * for the caller to free).
+ */
+
+int buildSteps(data_t *data, node_t *node, step_t **steps, int **deps)
+{
+	node_t *step;
+	int count = 0, total = 0, idx, dep;
+
+	for (step = node->left; step; step = step->next)
+		count++, total += step->count;
+	*steps = malloc(sizeof(step_t) * count);
+	*deps = malloc(sizeof(int) * (total + 1));
+	if (!*steps || !*deps)
+		return (-1);
+	total = 0;
+	for (idx = 0, step = node->left; step; step = step->next, idx++)
+	{
+		(*steps)[idx].node = step;
+		(*steps)[idx].state = STEP_PENDING;
+		(*steps)[idx].first = total;
+		dep = step->name ? findStep(node->left, step->name) : idx;
+		if (dep != idx && (stepLabel(step) || stepLabel((*steps)[dep].node)))
+		{
+			printShellErr(data, "concurrent: duplicate step ");
+			printErrStr(data, step->name);
+			printErrChar(data, '\n');
+			return (-1);
+		}
+		for (dep = 0; dep < step->count; dep++)
+		{
+			(*deps)[total] = findStep(node->left, step->words[dep]);
+			if ((*deps)[total++] == -1)
+			{
+				printShellErr(data, "concurrent: unknown step ");
+				printErrStr(data, step->words[dep]);
+				printErrChar(data, '\n');
+				return (-1);
+			}
+		}
+	}
+	return (count);
+}
+
+/**
+ * stepReady - Checks whether a pending step of a concurrent block can run.
+ * @steps: The steps.
+ * @deps: The dependency array.
+ * @idx: Index of the step.
+ *
+ * Return: STEP_READY once all the steps it runs after succeeded,
+ * STEP_SKIPPED as soon as one failed or was skipped, else STEP_PENDING.
+ */
+
+int stepReady(step_t *steps, int *deps, int idx)
+{
+	int dep, state, ready = STEP_READY;
+
+	for (dep = 0; dep < steps[idx].node->count; dep++)
+	{
+		state = steps[deps[steps[idx].first + dep]].state;
+		if (state == STEP_FAILED || state == STEP_SKIPPED)
+			return (STEP_SKIPPED);
+		if (state != STEP_DONE)
+			ready = STEP_PENDING;
+	}
+	return (ready);
+}
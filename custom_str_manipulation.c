@@ -92,3 +92,27 @@ char *concatSubstr(char *destString, char *srcString, int maxBytes)
 
 	return (result);
 }
+
+/**
+ * cmpStrN - Custom implementation of strncmp.
+ * @str1: The first string to compare.
+ * @str2: The second string to compare.
+ * @maxChar: The maximum number of characters to compare.
+ *
+ * Return: Negative value if str1 < str2, positive value if str1 > str2,
+ * 0 if the first @maxChar characters are equal.
+ */
+
+int cmpStrN(char *str1, char *str2, int maxChar)
+{
+	while (maxChar-- > 0)
+	{
+		if (*str1 != *str2)
+			return (*str1 - *str2);
+		if (!*str1)
+			return (0);
+		str1++;
+		str2++;
+	}
+	return (0);
+}
@@ -14,7 +14,9 @@ char **getEnv(data_t *data)
 {
 	if (!data->environ || data->envChanged)
 	{
+		freeStrArr(data->environ);
 		data->environ = itemListToArr(data->envList);
+		STATS_ADD(data, STAT_ALLOCS, getListLen(data->envList) + 1);
 		data->envChanged = 0;
 	}
 
@@ -38,10 +40,10 @@ int initEnvVar(data_t *data, char *varName, char *value)
 {
 	char *envVarStr = NULL;
 	item_t *currEnvVar;
-	char *subStr;
 
 	if (!varName || !value)
 		return (0);
+	touchSnapshot(data, SNAP_ENV);
 
 	envVarStr = malloc(strLength(varName) + strLength(value) + 2);
 	if (!envVarStr)
@@ -49,22 +51,20 @@ int initEnvVar(data_t *data, char *varName, char *value)
 	copyStr(envVarStr, varName);
 	concatStr(envVarStr, "=");
 	concatStr(envVarStr, value);
-	currEnvVar = data->envList;
-	while (currEnvVar)
+	if (!cmpStr(varName, "PATH"))
+		clearCmdCache(data);
+	currEnvVar = findVarNode(data, varName, strLength(varName));
+	if (currEnvVar)
 	{
-		subStr = findPrefix(currEnvVar->string, varName);
-		if (subStr && *subStr == '=')
-		{
-			free(currEnvVar->string);
-			currEnvVar->string = envVarStr;
-			data->envChanged = 1;
-			return (0);
-		}
-		currEnvVar = currEnvVar->next;
+		free(currEnvVar->string);
+		currEnvVar->string = envVarStr;
+		data->envChanged = 1;
+		return (0);
 	}
 	appendNodeToList(&(data->envList), envVarStr, 0);
 	free(envVarStr);
 	data->envChanged = 1;
+	data->varIndexValid = 0;
 	return (0);
 }
 
@@ -86,6 +86,9 @@ int rmvEnvVar(data_t *data, char *varName)
 
 	if (!node || !varName)
 		return (0);
+	touchSnapshot(data, SNAP_ENV);
+	if (!cmpStr(varName, "PATH"))
+		clearCmdCache(data);
 
 	while (node)
 	{
@@ -93,6 +96,7 @@ int rmvEnvVar(data_t *data, char *varName)
 		if (subStr && *subStr == '=')
 		{
 			data->envChanged = removeNodeAtIdx(&(data->envList), i);
+			data->varIndexValid = 0;
 			i = 0;
 			node = data->envList;
 			continue;
@@ -15,7 +15,7 @@ int initEnvironVar(data_t *data)
 {
 	if (data->argc != 3)
 	{
-		printErrStr("Number of arguments provided is not correct\n");
+		printErrStr(data, "Number of arguments provided is not correct\n");
 		return (1);
 	}
 	if (initEnvVar(data, data->argv[1], data->argv[2]))
@@ -39,7 +39,7 @@ int rmvEnvironVar(data_t *data)
 
 	if (data->argc == 1)
 	{
-		printErrStr("Incorrect number of arguments provided.\n");
+		printErrStr(data, "Incorrect number of arguments provided.\n");
 		return (1);
 	}
 	for (idx = 1; idx <= data->argc; idx++)
@@ -60,7 +60,7 @@ int rmvEnvironVar(data_t *data)
 
 int displayEnv(data_t *data)
 {
-	displayStrList(data->envList);
+	displayStrList(data, data->envList);
 	return (0);
 }
 
@@ -83,6 +83,7 @@ int initEnvList(data_t *data)
 	for (idx = 0; environ[idx]; idx++)
 		appendNodeToList(&node, environ[idx], 0);
 	data->envList = node;
+	data->varIndexValid = 0;
 	return (0);
 }
 
@@ -102,7 +103,13 @@ char *getEnvironVar(data_t *data, const char *name)
 {
 	item_t *node = data->envList;
 	char *value;
+	int length = strLength((char *)name);
 
+	if (length > 1 && name[length - 1] == '=')
+	{
+		value = lookupVar(data, name, length - 1);
+		return (value && *value ? value : NULL);
+	}
 	while (node)
 	{
 		value = findPrefix(node->string, name);
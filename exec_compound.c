@@ -0,0 +1,141 @@
+#include "shell.h"
+
+/**
+ * loopDone - Handles break, continue and exit at the end of a loop pass.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * "break n" and "continue n" unwind one loop per call until they reach
+ * the loop they name.
+ *
+ * Return: 1 if the loop must stop, 0 if it goes on with its next pass.
+ */
+
+int loopDone(data_t *data)
+{
+	int stop;
+
+	if (data->unwind != UNWIND_BREAK && data->unwind != UNWIND_CONTINUE)
+		return (data->unwind != 0);
+	if (--data->unwindCount > 0)
+		return (1);
+	stop = (data->unwind == UNWIND_BREAK);
+	data->unwind = 0;
+	return (stop);
+}
+
+/**
+ * execLoop - Runs a while or until loop.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The loop node.
+ *
+ * Return: Nothing. The exit status is that of the last pass of the body,
+ * or 0 if it never ran.
+ */
+
+void execLoop(data_t *data, node_t *node)
+{
+	int status = 0, until = (node->type == NODE_UNTIL);
+
+	data->loopDepth++;
+	while (1)
+	{
+		execNode(data, node->left);
+		if (data->unwind && loopDone(data))
+			break;
+		if ((data->execStat == 0) == until)
+			break;
+		execNode(data, node->right);
+		status = data->execStat;
+		if (data->unwind && loopDone(data))
+			break;
+	}
+	data->loopDepth--;
+	data->execStat = status;
+}
+
+/**
+ * execFor - Runs a for loop.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The loop node.
+ *
+ * The word list is expanded once, before the first pass. Without an "in"
+ * part the loop runs over the positional parameters.
+ *
+ * Return: Nothing.
+ */
+
+void execFor(data_t *data, node_t *node)
+{
+	char **values = NULL;
+	int idx, count = 0, size = 0;
+
+	data->lineCounter = node->line;
+	if (node->words)
+		expandWords(data, node->words, &values, &count, &size);
+	for (idx = 0; !node->words && idx < data->posCount; idx++)
+		pushArg(&values, &count, &size, dupStr(data->posArgs[idx]));
+	if (!data->unwind)
+		data->execStat = 0;
+	data->loopDepth++;
+	for (idx = 0; idx < count; idx++)
+	{
+		initEnvVar(data, node->name, values[idx]);
+		execNode(data, node->right);
+		if (data->unwind && loopDone(data))
+			break;
+	}
+	data->loopDepth--;
+	freeStrArr(values);
+}
+
+/**
+ * caseMatches - Checks if a case item matches a word.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @item: The case item.
+ * @subject: The expanded word.
+ *
+ * Return: 1 if one of the item's patterns matches @subject, 0 otherwise.
+ */
+
+int caseMatches(data_t *data, node_t *item, char *subject)
+{
+	char *pattern;
+	int idx, matched = 0;
+
+	for (idx = 0; idx < item->count && !matched; idx++)
+	{
+		pattern = expandPattern(data, item->words[idx],
+				strLength(item->words[idx]));
+		matched = pattern && matchPattern(pattern, subject,
+				strLength(subject));
+		free(pattern);
+	}
+	return (matched);
+}
+
+/**
+ * execCase - Runs a case statement.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The case node.
+ *
+ * Return: Nothing.
+ */
+
+void execCase(data_t *data, node_t *node)
+{
+	char *subject;
+	node_t *item;
+
+	data->lineCounter = node->line;
+	subject = expandOperand(data, node->name, strLength(node->name));
+	if (!data->unwind)
+		data->execStat = 0;
+	for (item = node->left; item && subject && !data->unwind;
+			item = item->next)
+		if (caseMatches(data, item, subject))
+		{
+			execNode(data, item->right);
+			break;
+		}
+	free(subject);
+}
@@ -0,0 +1,156 @@
+#include "shell.h"
+
+/**
+ * isAssignment - Checks if a word is a NAME=value assignment.
+ * @word: The word to check.
+ *
+ * Return: 1 if it is, 0 otherwise.
+ */
+
+int isAssignment(char *word)
+{
+	int length = nameLength(word);
+
+	return (length && word[length] == '=');
+}
+
+/**
+ * assignVars - Performs the NAME=value assignments of a command.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @words: The assignment words.
+ * @count: Number of assignments.
+ * @saved: If not NULL, receives the previous value of each variable (NULL
+ * for one that was not set), so restoreVars() can undo the assignments.
+ *
+ * Return: Nothing.
+ */
+
+void assignVars(data_t *data, char **words, int count, char **saved)
+{
+	int idx, length;
+	char *name, *value;
+
+	for (idx = 0; idx < count; idx++)
+	{
+		length = nameLength(words[idx]);
+		name = malloc(length + 1);
+		if (!name)
+			return;
+		copySubstr(name, words[idx], length + 1);
+		value = expandOperand(data, words[idx] + length + 1,
+				strLength(words[idx] + length + 1));
+		if (saved)
+			saved[idx] = dupStr(lookupVar(data, name, length));
+		initEnvVar(data, name, value ? value : "");
+		free(value);
+		free(name);
+	}
+}
+
+/**
+ * restoreVars - Undoes assignments made by assignVars().
+ * @data: Pointer to the data_t struct containing shell information.
+ * @words: The assignment words.
+ * @count: Number of assignments.
+ * @saved: The previous values (freed here).
+ *
+ * Return: Nothing.
+ */
+
+void restoreVars(data_t *data, char **words, int count, char **saved)
+{
+	int idx, length;
+	char *name;
+
+	for (idx = count - 1; idx >= 0; idx--)
+	{
+		length = nameLength(words[idx]);
+		name = malloc(length + 1);
+		if (name)
+		{
+			copySubstr(name, words[idx], length + 1);
+			if (saved[idx])
+				initEnvVar(data, name, saved[idx]);
+			else
+				rmvEnvVar(data, name);
+		}
+		free(name);
+		free(saved[idx]);
+	}
+	free(saved);
+}
+
+/**
+ * hasCmdSubst - Checks if any of a command's words runs a command
+ * substitution.
+ * @words: The words.
+ * @count: Number of words.
+ *
+ * Return: 1 if one does, 0 otherwise.
+ */
+
+int hasCmdSubst(char **words, int count)
+{
+	char *str;
+	int idx;
+
+	for (idx = 0; idx < count; idx++)
+		for (str = words[idx]; *str; str++)
+			if (*str == '`' || (*str == '$' && str[1] == '(' && str[2] != '('))
+				return (1);
+	return (0);
+}
+
+/**
+ * execSimpleCmd - Runs a simple command.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The command node.
+ *
+ * The words are expanded from the parsed tree on every run. Leading
+ * NAME=value words set shell variables when they are all there is,
+ * otherwise they only apply while the command runs. Without a command, the
+ * exit status is that of the last command substitution, or 0. Nothing is
+ * run if an expansion fails.
+ *
+ * Return: The exit status of the command.
+ */
+
+int execSimpleCmd(data_t *data, node_t *node)
+{
+	int assigns = 0, count = 0, size = 0;
+	char **args = NULL, **saved = NULL;
+	long start = STATS_BEGIN(data);
+
+	data->lineCounter = node->line;
+	while (assigns < node->count && isAssignment(node->words[assigns]))
+		assigns++;
+	if (assigns < node->count)
+		expandCmdWords(data, node->words + assigns, 0, &args, &count, &size);
+	STATS_END(data, PHASE_EXPAND, start);
+	STATS_ADD(data, STAT_ALLOCS, count + 1);
+	if (!count || data->unwind)
+	{
+		freeStrArr(args);
+		if (!data->unwind)
+			assignVars(data, node->words, assigns, NULL);
+		if (!data->unwind && !hasCmdSubst(node->words, node->count))
+			data->execStat = 0;
+		return (data->execStat);
+	}
+	if (assigns)
+		saved = malloc(sizeof(char *) * assigns);
+	if (saved)
+		assignVars(data, node->words, assigns, saved);
+	data->argv = args;
+	data->argc = count;
+	data->execTail = (node == data->tailCmd && data->trace.fd == -1);
+	start = (data->trace.fd != -1 && !data->unwind) ? nowNanos() : 0;
+	if (!data->unwind)
+		runArgv(data);
+	if (start && data->trace.fd != -1)
+		traceCommand(data, start);
+	freeShellData(data, 0);
+	if (saved)
+		restoreVars(data, node->words, assigns, saved);
+	return (data->execStat);
+}
@@ -0,0 +1,135 @@
+#include "shell.h"
+
+/**
+ * execProgram - Runs a parsed program.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @prog: The program.
+ *
+ * The program is held while it runs, so it stays valid even if something
+ * it runs drops the caller's reference, and is made the current program
+ * so that functions defined in it can keep it alive.
+ *
+ * Return: The exit status of the last command run.
+ */
+
+int execProgram(data_t *data, program_t *prog)
+{
+	program_t *outer = data->program;
+
+	data->program = retainProgram(prog);
+	execNode(data, prog->root);
+	data->program = outer;
+	releaseProgram(prog);
+	return (data->execStat);
+}
+
+/**
+ * execNode - Runs a command tree.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The tree (may be NULL).
+ *
+ * Lists are walked in a loop; nothing more runs once break, continue or
+ * exit has started unwinding.
+ *
+ * Return: The exit status of the last command run.
+ */
+
+int execNode(data_t *data, node_t *node)
+{
+	for (; node && !data->unwind; node = node->right)
+	{
+		if (node->type != NODE_LIST && node->redirs)
+			return (execRedirected(data, node));
+		if (node->type != NODE_LIST)
+			return (execCommand(data, node));
+		execNode(data, node->left);
+	}
+	return (data->execStat);
+}
+
+/**
+ * execCommand - Runs one node of a command tree other than a list.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The node.
+ *
+ * Return: The exit status of the command.
+ */
+
+int execCommand(data_t *data, node_t *node)
+{
+	usage_t mark;
+
+	switch (node->type)
+	{
+	case NODE_CMD:
+	case NODE_PIPE:
+		startUsage(data, &mark);
+		if (node->type == NODE_CMD)
+			execSimpleCmd(data, node);
+		else
+			execPipeline(data, node);
+		endUsage(data, &mark, &data->lastUsage);
+		break;
+	case NODE_AND:
+	case NODE_OR:
+		execNode(data, node->left);
+		if (!data->unwind
+				&& (data->execStat == 0) == (node->type == NODE_AND))
+			execNode(data, node->right);
+		break;
+	case NODE_NOT:
+		execNode(data, node->left);
+		data->execStat = !data->execStat;
+		break;
+	case NODE_GROUP:
+		execNode(data, node->left);
+		break;
+	case NODE_IF:
+		execIf(data, node);
+		break;
+	case NODE_WHILE:
+	case NODE_UNTIL:
+		execLoop(data, node);
+		break;
+	case NODE_FOR:
+		execFor(data, node);
+		break;
+	case NODE_CASE:
+		execCase(data, node);
+		break;
+	case NODE_TIME:
+		execTimed(data, node);
+		break;
+	case NODE_SUBSHELL:
+		execSubshell(data, node);
+		break;
+	case NODE_CONCURRENT:
+		execConcurrent(data, node);
+		break;
+	case NODE_FUNC:
+		data->execStat = defineFunc(data, node);
+		break;
+	}
+	return (data->execStat);
+}
+
+/**
+ * execIf - Runs an if statement.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The if node (an elif is a nested if in the else branch).
+ *
+ * Return: Nothing.
+ */
+
+void execIf(data_t *data, node_t *node)
+{
+	execNode(data, node->left);
+	if (data->unwind)
+		return;
+	if (!data->execStat)
+		execNode(data, node->right);
+	else if (node->next)
+		execNode(data, node->next);
+	else
+		data->execStat = 0;
+}
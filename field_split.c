@@ -0,0 +1,152 @@
+#include "shell.h"
+
+/**
+ * pushArg - Appends a string to a growable argument vector.
+ * @args: Pointer to the NULL-terminated vector.
+ * @count: Pointer to the number of strings in the vector.
+ * @size: Pointer to the number of slots allocated.
+ * @str: The string to append (ownership passes to the vector).
+ *
+ * Return: 0 on success, or 1 on allocation failure.
+ */
+
+int pushArg(char ***args, int *count, int *size, char *str)
+{
+	char **newArgs;
+	int newSize = *size ? *size * 2 : 8;
+
+	if (!str)
+		return (1);
+	if (*count + 1 >= *size)
+	{
+		newArgs = memRealloc(*args, sizeof(char *) * *size,
+				sizeof(char *) * newSize);
+		if (!newArgs)
+			return (free(str), 1);
+		*args = newArgs;
+		*size = newSize;
+	}
+	(*args)[(*count)++] = str;
+	(*args)[*count] = NULL;
+	return (0);
+}
+
+/**
+ * pushField - Appends a field, expanding it to pathnames if it contains
+ * unquoted pattern characters and removing its escapes otherwise.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @args: Pointer to the vector receiving the field.
+ * @count: Pointer to the number of strings in the vector.
+ * @size: Pointer to the number of slots allocated.
+ * @field: The field (ownership passes to this function).
+ *
+ * Return: Nothing.
+ */
+
+void pushField(data_t *data, char ***args, int *count, int *size, char *field)
+{
+	if (field && hasGlobChars(field))
+		expandGlob(data, field, args, count, size);
+	else
+		pushArg(args, count, size, removeEscapes(field));
+}
+
+/**
+ * markFields - Marks where an unquoted expansion is split into fields.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @start: Offset in the expansion buffer where the expansion's result
+ * begins.
+ *
+ * Every character of the result found in IFS (space, tab and newline if
+ * IFS is unset, nothing if it is empty) becomes a field separator, and
+ * the word is then split. Inside double quotes the result is left as it is.
+ *
+ * Return: Nothing.
+ */
+
+void markFields(data_t *data, size_t start)
+{
+	char *ifs = lookupVar(data, "IFS", 3);
+
+	if (data->expQuoted & 2)
+		return;
+	if (!ifs)
+		ifs = " \t\n";
+	for (; *ifs && start < data->exp.len; start++)
+		if (isDelim(data->exp.buf[start], ifs))
+		{
+			data->exp.buf[start] = FIELD_SEPARATOR;
+			data->expSplit = 1;
+		}
+}
+
+/**
+ * splitFields - Splits the expansion buffer at field separators.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @args: Pointer to the vector receiving the fields.
+ * @count: Pointer to the number of strings in the vector.
+ * @size: Pointer to the number of slots allocated.
+ *
+ * Runs of separators produce no empty fields, so an expansion that is
+ * empty or all blanks adds nothing. Fields next to a FIELD_BREAK are kept
+ * even when empty.
+ *
+ * Return: Nothing.
+ */
+
+void splitFields(data_t *data, char ***args, int *count, int *size)
+{
+	char *field = data->exp.buf, *end, *copy;
+	int broken = 0;
+
+	while (1)
+	{
+		while (*field == FIELD_SEPARATOR)
+			field++, broken = 0;
+		end = field;
+		while (*end && *end != FIELD_SEPARATOR && *end != FIELD_BREAK)
+			end++;
+		if (end > field || broken || *end == FIELD_BREAK)
+		{
+			copy = malloc(end - field + 1);
+			if (copy)
+				copySubstr(copy, field, end - field + 1);
+			pushField(data, args, count, size, copy);
+		}
+		if (!*end)
+			break;
+		broken = (*end == FIELD_BREAK);
+		field = end + 1;
+	}
+}
+
+/**
+ * expandWords - Expands a list of words into command arguments.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @words: The NULL-terminated list of words (left unchanged).
+ * @args: Pointer to the vector receiving the arguments.
+ * @count: Pointer to the number of strings in the vector.
+ * @size: Pointer to the number of slots allocated.
+ *
+ * The results of unquoted parameter expansions and command substitutions
+ * are split into separate arguments at the characters in IFS, and every
+ * field containing an unquoted *, ? or [ is expanded to the pathnames it
+ * matches. An unquoted word that expands to nothing adds no
+ * argument.
+ *
+ * Return: Nothing.
+ */
+
+void expandWords(data_t *data, char **words, char ***args, int *count,
+		int *size)
+{
+	for (; words && *words; words++)
+	{
+		if (!expandWord(data, *words))
+			pushField(data, args, count, size, dupStr(*words));
+		else if (data->expSplit)
+			splitFields(data, args, count, size);
+		else if (data->exp.len || data->expQuoted)
+			pushField(data, args, count, size, dupStr(data->exp.buf));
+	}
+}
@@ -0,0 +1,85 @@
+#include "shell.h"
+
+/**
+ * trueCmd - Does nothing, successfully (the true and : builtins).
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: 0 (Always).
+ */
+
+int trueCmd(data_t *data)
+{
+	(void)data;
+	return (0);
+}
+
+/**
+ * falseCmd - Does nothing, unsuccessfully.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: 1 (Always).
+ */
+
+int falseCmd(data_t *data)
+{
+	(void)data;
+	return (1);
+}
+
+/**
+ * loopJump - Starts unwinding to an enclosing loop.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @how: UNWIND_BREAK or UNWIND_CONTINUE.
+ *
+ * The optional argument gives the number of loops to leave; it is capped
+ * at the number of enclosing loops. Outside of a loop nothing happens.
+ *
+ * Return: 0 on success, or 1 if the argument is not a positive number.
+ */
+
+int loopJump(data_t *data, int how)
+{
+	int levels = 1;
+
+	if (data->argv[1])
+	{
+		levels = errStrToInt(data->argv[1]);
+		if (levels < 1)
+		{
+			printShellErr(data, "Illegal number: ");
+			printErrStr(data, data->argv[1]);
+			printErrChar(data, '\n');
+			return (1);
+		}
+	}
+	if (!data->loopDepth)
+		return (0);
+	data->unwind = how;
+	data->unwindCount = levels < data->loopDepth ? levels : data->loopDepth;
+	return (0);
+}
+
+/**
+ * breakCmd - Leaves the innermost loop, or the nth enclosing one.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: 0 on success, or 1 on error.
+ */
+
+int breakCmd(data_t *data)
+{
+	return (loopJump(data, UNWIND_BREAK));
+}
+
+/**
+ * continueCmd - Starts the next pass of the innermost loop, or of the nth
+ * enclosing one.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: 0 on success, or 1 on error.
+ */
+
+int continueCmd(data_t *data)
+{
+	return (loopJump(data, UNWIND_CONTINUE));
+}
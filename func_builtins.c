@@ -0,0 +1,136 @@
+#include "shell.h"
+
+/**
+ * saveLocal - Remembers the value a variable has before it is made local.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @name: The variable name.
+ *
+ * Only the first "local" of a name in a function call saves anything, so
+ * popLocals() restores the value from before the call.
+ *
+ * Return: Nothing.
+ */
+
+void saveLocal(data_t *data, char *name)
+{
+	item_t *node;
+	int length = strLength(name);
+
+	for (node = data->localVars; node && node->number == data->funcDepth;
+			node = node->next)
+		if (!cmpStrN(node->string, name, length)
+				&& (!node->string[length] || node->string[length] == '='))
+			return;
+	node = findVarNode(data, name, length);
+	prependNodeToList(&data->localVars, node ? node->string : name,
+			data->funcDepth);
+}
+
+/**
+ * localCmd - Makes variables local to the running function.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Each argument is NAME or NAME=value; a variable keeps its current value
+ * unless one is given, and gets its old value back when the function
+ * returns.
+ *
+ * Return: 0 on success, or 1 on error.
+ */
+
+int localCmd(data_t *data)
+{
+	int idx, length, hasValue, status = 0;
+	char *word;
+
+	if (!data->funcDepth)
+	{
+		printShellErr(data, "not in a function\n");
+		return (1);
+	}
+	for (idx = 1; data->argv[idx]; idx++)
+	{
+		word = data->argv[idx];
+		length = nameLength(word);
+		hasValue = (word[length] == '=');
+		if (!length || (word[length] && !hasValue))
+		{
+			printShellErr(data, "bad variable name: ");
+			printErrStr(data, word);
+			printErrChar(data, '\n');
+			status = 1;
+			continue;
+		}
+		word[length] = '\0';
+		saveLocal(data, word);
+		if (hasValue)
+			initEnvVar(data, word, word + length + 1);
+	}
+	return (status);
+}
+
+/**
+ * returnCmd - Returns from the running function or sourced file.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Without an argument the function returns the status of the last command.
+ *
+ * Return: The status to return with, or 1 or 2 on error.
+ */
+
+int returnCmd(data_t *data)
+{
+	int status = data->execStat;
+
+	if (data->argv[1])
+	{
+		status = errStrToInt(data->argv[1]);
+		if (status == -1)
+		{
+			printShellErr(data, "Illegal number: ");
+			printErrStr(data, data->argv[1]);
+			printErrChar(data, '\n');
+			return (2);
+		}
+	}
+	if (!data->funcDepth && !data->sourceDepth)
+	{
+		printShellErr(data, "not in a function\n");
+		return (1);
+	}
+	data->unwind = UNWIND_RETURN;
+	return (status & 0xff);
+}
+
+/**
+ * shiftCmd - Shifts the positional parameters to the left.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * The optional argument gives the number of places to shift (1 by default).
+ *
+ * Return: 0 on success, or 1 or 2 on error.
+ */
+
+int shiftCmd(data_t *data)
+{
+	int count = 1;
+
+	if (data->argv[1])
+	{
+		count = errStrToInt(data->argv[1]);
+		if (count == -1)
+		{
+			printShellErr(data, "Illegal number: ");
+			printErrStr(data, data->argv[1]);
+			printErrChar(data, '\n');
+			return (2);
+		}
+	}
+	if (count > data->posCount)
+	{
+		printShellErr(data, "can't shift that many\n");
+		return (1);
+	}
+	data->posArgs += count;
+	data->posCount -= count;
+	return (0);
+}
@@ -0,0 +1,143 @@
+#include "shell.h"
+
+/**
+ * findFunc - Finds a shell function by name.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @name: The function name.
+ *
+ * Return: The function, or NULL if there is none by that name.
+ */
+
+func_t *findFunc(data_t *data, char *name)
+{
+	func_t *func;
+
+	for (func = data->funcList; func; func = func->next)
+		if (!cmpStr(func->name, name))
+			return (func);
+	return (NULL);
+}
+
+/**
+ * defineFunc - Defines (or redefines) a shell function.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The function definition node.
+ *
+ * The function keeps the current program alive instead of copying its
+ * body, and the command cache is cleared since the name may have meant
+ * something else until now.
+ *
+ * Return: 0 on success, or 1 on allocation failure.
+ */
+
+int defineFunc(data_t *data, node_t *node)
+{
+	func_t *func = findFunc(data, node->name);
+
+	if (!func)
+	{
+		func = malloc(sizeof(func_t));
+		if (!func)
+			return (1);
+		func->name = dupStr(node->name);
+		if (!func->name)
+			return (free(func), 1);
+		func->prog = NULL;
+		func->next = data->funcList;
+		data->funcList = func;
+	}
+	retainProgram(data->program);
+	releaseProgram(func->prog);
+	func->prog = data->program;
+	func->body = node->left;
+	clearCmdCache(data);
+	return (0);
+}
+
+/**
+ * clearFuncs - Frees every shell function.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: Nothing.
+ */
+
+void clearFuncs(data_t *data)
+{
+	func_t *func;
+
+	while (data->funcList)
+	{
+		func = data->funcList;
+		data->funcList = func->next;
+		releaseProgram(func->prog);
+		free(func->name);
+		free(func);
+	}
+}
+
+/**
+ * callFunction - Runs a shell function with the current command's
+ * arguments as its positional parameters.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @func: The function.
+ *
+ * The body runs in-process straight from its parsed tree. The function's
+ * program is held for the duration of the call, so the function may even
+ * redefine itself.
+ *
+ * Return: The exit status of the function.
+ */
+
+int callFunction(data_t *data, func_t *func)
+{
+	cmd_state_t state;
+	char **outerArgs = data->posArgs;
+	int outerCount = data->posCount, outerLoops = data->loopDepth;
+	program_t *outer = data->program, *prog = retainProgram(func->prog);
+
+	saveCmdState(data, &state);
+	data->posArgs = state.argv + 1;
+	data->posCount = state.argc - 1;
+	data->loopDepth = 0;
+	data->program = prog;
+	data->funcDepth++;
+	execNode(data, func->body);
+	popLocals(data);
+	data->funcDepth--;
+	if (data->unwind == UNWIND_RETURN)
+		data->unwind = 0;
+	data->program = outer;
+	data->loopDepth = outerLoops;
+	data->posArgs = outerArgs;
+	data->posCount = outerCount;
+	restoreCmdState(data, &state);
+	releaseProgram(prog);
+	return (data->execStat);
+}
+
+/**
+ * popLocals - Restores the variables made local by the function that is
+ * returning.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: Nothing.
+ */
+
+void popLocals(data_t *data)
+{
+	item_t *node;
+	char *eqlPosition;
+
+	while ((node = data->localVars) && node->number == data->funcDepth)
+	{
+		eqlPosition = findChar(node->string, '=');
+		if (eqlPosition)
+		{
+			*eqlPosition = '\0';
+			initEnvVar(data, node->string, eqlPosition + 1);
+		}
+		else
+			rmvEnvVar(data, node->string);
+		removeNodeAtIdx(&data->localVars, 0);
+	}
+}
@@ -0,0 +1,115 @@
+#include "shell.h"
+
+/**
+ * sortNames - Sorts an array of strings in place (shell sort).
+ * @names: The array to sort.
+ * @count: Number of strings in @names.
+ *
+ * Return: Nothing.
+ */
+
+void sortNames(char **names, int count)
+{
+	int gap, idx, pos;
+	char *name;
+
+	for (gap = count / 2; gap > 0; gap /= 2)
+		for (idx = gap; idx < count; idx++)
+		{
+			name = names[idx];
+			for (pos = idx; pos >= gap && cmpStr(names[pos - gap], name) > 0;
+					pos -= gap)
+				names[pos] = names[pos - gap];
+			names[pos] = name;
+		}
+}
+
+/**
+ * readDirListing - Reads and sorts the entries of a directory.
+ * @path: The directory to read.
+ *
+ * "." and ".." are left out. A directory that cannot be read gives an
+ * empty listing, so it is not retried.
+ *
+ * Return: The new listing, or NULL on allocation failure.
+ */
+
+glob_dir_t *readDirListing(char *path)
+{
+	glob_dir_t *dir = malloc(sizeof(glob_dir_t));
+	DIR *stream;
+	struct dirent *entry;
+	int size = 0;
+
+	if (!dir)
+		return (NULL);
+	fillMemWithByte((char *)dir, 0, sizeof(glob_dir_t));
+	dir->path = dupStr(path);
+	stream = opendir(path);
+	while (stream && (entry = readdir(stream)))
+	{
+		if (!cmpStr(entry->d_name, ".") || !cmpStr(entry->d_name, ".."))
+			continue;
+		pushArg(&dir->names, &dir->count, &size, dupStr(entry->d_name));
+	}
+	if (stream)
+		closedir(stream);
+	sortNames(dir->names, dir->count);
+	return (dir);
+}
+
+/**
+ * getDirListing - Returns the sorted listing of a directory, reading it
+ * at most once per command line.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @path: The directory.
+ *
+ * Several patterns on the same line that look in the same directory share
+ * one pass over its entries.
+ *
+ * Return: The listing (owned by the cache), or NULL on allocation failure.
+ */
+
+glob_dir_t *getDirListing(data_t *data, char *path)
+{
+	glob_dir_t *dir;
+
+	for (dir = data->globCache; dir; dir = dir->next)
+		if (!cmpStr(dir->path, path))
+		{
+			STATS_ADD(data, STAT_GLOB_HITS, 1);
+			return (dir);
+		}
+	STATS_ADD(data, STAT_GLOB_MISSES, 1);
+	dir = readDirListing(path);
+	if (dir)
+	{
+		dir->next = data->globCache;
+		data->globCache = dir;
+	}
+	return (dir);
+}
+
+/**
+ * clearGlobCache - Forgets every cached directory listing.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Called once a command line has been run, so later lines see changes
+ * made to the file system.
+ *
+ * Return: Nothing.
+ */
+
+void clearGlobCache(data_t *data)
+{
+	glob_dir_t *dir;
+
+	while (data->globCache)
+	{
+		dir = data->globCache;
+		data->globCache = dir->next;
+		free(dir->path);
+		freeStrArr(dir->names);
+		free(dir);
+	}
+}
@@ -0,0 +1,149 @@
+#include "shell.h"
+
+/**
+ * joinPath - Builds prefix + name (+ '/').
+ * @prefix: The directory prefix (empty or ending with '/').
+ * @name: The name to append (need not be NUL-terminated).
+ * @length: Length of @name.
+ * @slash: True to append a trailing '/'.
+ *
+ * Return: The new path, or NULL on allocation failure.
+ */
+
+char *joinPath(char *prefix, char *name, int length, int slash)
+{
+	int prefixLen = strLength(prefix);
+	char *path = malloc(prefixLen + length + 2);
+
+	if (!path)
+		return (NULL);
+	copyStr(path, prefix);
+	copySubstr(path + prefixLen, name, length + 1);
+	if (slash)
+		concatStr(path, "/");
+	return (path);
+}
+
+/**
+ * globLiteral - Continues a match through a component without patterns.
+ * @glob: The expansion in progress.
+ * @prefix: The path matched so far.
+ * @comp: The literal component.
+ * @compLen: Length of @comp.
+ * @rest: The components after this one, or NULL if it is the last.
+ *
+ * Return: Nothing.
+ */
+
+void globLiteral(glob_state_t *glob, char *prefix, char *comp, int compLen,
+		char *rest)
+{
+	struct stat fileStat;
+	char *path = joinPath(prefix, comp, compLen, rest != NULL);
+
+	if (!path)
+		return;
+	if (rest)
+		globPath(glob, path, rest);
+	else if (!lstat(path, &fileStat))
+	{
+		pushArg(glob->args, glob->count, glob->size, path);
+		glob->matched++;
+		return;
+	}
+	free(path);
+}
+
+/**
+ * globPath - Expands the remaining pattern components below a prefix.
+ * @glob: The expansion in progress.
+ * @prefix: The path matched so far (empty or ending with '/').
+ * @pattern: The remaining pattern components.
+ *
+ * Each component containing pattern characters is matched against the
+ * cached, sorted listing of its directory, so results come out sorted.
+ * Names starting with '.' only match components starting with '.'. Other
+ * components are used with their escapes removed.
+ *
+ * Return: Nothing.
+ */
+
+void globPath(glob_state_t *glob, char *prefix, char *pattern)
+{
+	char *slash, *comp, *path, *name;
+	int compLen, idx;
+	glob_dir_t *dir = NULL;
+
+	while (*pattern == '/')
+		pattern++;
+	slash = findChar(pattern, '/');
+	compLen = slash ? slash - pattern : strLength(pattern);
+	comp = joinPath("", pattern, compLen, 0);
+	if (comp && hasGlobChars(comp))
+		dir = getDirListing(glob->data, *prefix ? prefix : ".");
+	else if (comp)
+		globLiteral(glob, prefix, removeEscapes(comp), strLength(comp),
+				slash ? slash + 1 : NULL);
+	for (idx = 0; dir && idx < dir->count; idx++)
+	{
+		name = dir->names[idx];
+		if ((*name == '.' && *comp != '.')
+				|| !matchPattern(comp, name, strLength(name)))
+			continue;
+		path = joinPath(prefix, name, strLength(name), slash != NULL);
+		if (path && slash && slash[1])
+		{
+			globPath(glob, path, slash + 1);
+			free(path);
+		}
+		else if (path && (!slash || isDirectory(path)))
+			pushArg(glob->args, glob->count, glob->size, path), glob->matched++;
+		else
+			free(path);
+	}
+	free(comp);
+}
+
+/**
+ * isDirectory - Checks if a path names a directory.
+ * @path: The path to check.
+ *
+ * Return: 1 if it does, 0 otherwise.
+ */
+
+int isDirectory(char *path)
+{
+	struct stat fileStat;
+
+	return (!stat(path, &fileStat) && S_ISDIR(fileStat.st_mode));
+}
+
+/**
+ * expandGlob - Expands a word containing *, ? or [...] to matching paths.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @word: The word to expand (ownership passes to this function).
+ * @args: Pointer to the vector receiving the results.
+ * @count: Pointer to the number of strings in the vector.
+ * @size: Pointer to the number of slots allocated.
+ *
+ * Matches are added in sorted order. A word that matches nothing is added
+ * with its escapes removed.
+ *
+ * Return: Nothing.
+ */
+
+void expandGlob(data_t *data, char *word, char ***args, int *count, int *size)
+{
+	glob_state_t glob;
+
+	glob.data = data;
+	glob.args = args;
+	glob.count = count;
+	glob.size = size;
+	glob.matched = 0;
+	globPath(&glob, *word == '/' ? "/" : "", word);
+	if (glob.matched)
+		free(word);
+	else
+		pushArg(args, count, size, removeEscapes(word));
+}
@@ -0,0 +1,120 @@
+#include "shell.h"
+
+/**
+ * expandHereDoc - Expands the body of an unquoted here-document.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @body: The body.
+ *
+ * The body is expanded as if it were inside double quotes, except that
+ * double quotes are ordinary characters: a backslash only escapes $, `,
+ * \ and newline.
+ *
+ * Return: Nothing.
+ */
+
+void expandHereDoc(data_t *data, char *body)
+{
+	char *start = body;
+	int quoted = data->expQuoted;
+
+	data->expQuoted |= 2;
+	while (*body)
+	{
+		if (*body == '\\' && isDelim(body[1], "$`\\\n"))
+		{
+			appendExpBuf(data, start, body - start);
+			if (body[1] != '\n')
+				appendExpBuf(data, body + 1, 1);
+			start = body += 2;
+		}
+		else if (*body == '$' || *body == '`')
+		{
+			appendExpBuf(data, start, body - start);
+			start = body += expandParam(data, body);
+		}
+		else
+			body++;
+	}
+	appendExpBuf(data, start, body - start);
+	data->expQuoted = quoted;
+}
+
+/**
+ * hereDocFd - Makes a file descriptor to read a here-document from.
+ * @text: The text of the document.
+ * @length: Length of @text.
+ *
+ * A short document is written into a pipe, which holds it without any
+ * reader. A longer one could fill the pipe, so it goes into an anonymous
+ * memory file instead, which also never touches the disk.
+ *
+ * Return: The file descriptor, positioned at the start, or -1 on error.
+ */
+
+int hereDocFd(char *text, size_t length)
+{
+	int fds[2];
+
+	if (length <= HEREDOC_PIPE_MAX)
+	{
+		if (pipe(fds) == -1)
+			return (-1);
+		write(fds[1], text, length);
+		close(fds[1]);
+		return (fds[0]);
+	}
+	fds[0] = syscall(SYS_memfd_create, "hsh-heredoc", MFD_CLOEXEC);
+	if (fds[0] == -1)
+		return (-1);
+	if (write(fds[0], text, length) != (ssize_t)length
+			|| lseek(fds[0], 0, SEEK_SET) == -1)
+	{
+		close(fds[0]);
+		return (-1);
+	}
+	return (fds[0]);
+}
+
+/**
+ * openHereDoc - Opens a here-document or here-string for reading.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @redir: The redirection.
+ *
+ * A body without expansions was finished by the parser and is used as it
+ * is; anything else is expanded past the text already in the expansion
+ * buffer, which is restored afterwards. A here-string gets a newline.
+ *
+ * Return: The file descriptor, or -1 on error.
+ */
+
+int openHereDoc(data_t *data, redir_t *redir)
+{
+	size_t base = data->exp.len, idx;
+	char *text;
+	int fd;
+
+	if (redir->type != REDIR_HERESTR && !redir->expand)
+		return (hereDocFd(redir->word, strLength(redir->word)));
+	if (redir->type == REDIR_HERESTR)
+	{
+		text = expandOperand(data, redir->word, strLength(redir->word));
+		if (!text)
+			return (-1);
+		appendExpBuf(data, text, strLength(text));
+		appendExpBuf(data, "\n", 1);
+		free(text);
+	}
+	else
+		expandHereDoc(data, redir->word);
+	for (idx = base; idx < data->exp.len; idx++)
+		if (data->exp.buf[idx] == FIELD_SEPARATOR
+				|| data->exp.buf[idx] == FIELD_BREAK)
+			data->exp.buf[idx] = ' ';
+	if (data->exp.buf)
+		data->exp.len = base + strLength(removeEscapes(data->exp.buf + base));
+	fd = hereDocFd(data->exp.buf + base, data->exp.len - base);
+	data->exp.len = base;
+	if (data->exp.buf)
+		data->exp.buf[base] = '\0';
+	return (fd);
+}
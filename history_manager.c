@@ -82,11 +82,11 @@ int saveHistoryToFile(data_t *data)
 
 	for (node = data->historyList; node; node = node->next)
 	{
-		printStrToDesc(node->string, fileDesc);
-		printCharToDesc('\n', fileDesc);
+		printStrToDesc(data, node->string, fileDesc);
+		printCharToDesc(data, '\n', fileDesc);
 	}
 
-	printCharToDesc(FLUSH_BUFFER_FLAG, fileDesc);
+	printCharToDesc(data, FLUSH_BUFFER_FLAG, fileDesc);
 	close(fileDesc);
 	return (1);
 }
@@ -105,7 +105,7 @@ int saveHistoryToFile(data_t *data)
 int loadHistoryFromFile(data_t *data)
 {
 	int index, linesRead = 0, linesCount = 0;
-	ssize_t fileDesc, bytesRead, fileSize = 0;
+	ssize_t fileDesc, fileSize = 0;
 	struct stat fileStat;
 	char *fileContent = NULL, *filename = generateHistPath(data);
 
@@ -119,14 +119,11 @@ int loadHistoryFromFile(data_t *data)
 		fileSize = fileStat.st_size;
 	if (fileSize < 2)
 		return (0);
-	fileContent = malloc(sizeof(char) * (fileSize + 1));
+	fileContent = readFileText(fileDesc, fileSize);
+	close(fileDesc);
 	if (!fileContent)
 		return (0);
-	bytesRead = read(fileDesc, fileContent, fileSize);
-	fileContent[fileSize] = 0;
-	if (bytesRead <= 0)
-		return (free(fileContent), 0);
-	close(fileDesc);
+	fileSize = strLength(fileContent);
 	for (index = 0; index < fileSize; index++)
 	{
 		if (fileContent[index] == '\n')
@@ -0,0 +1,24 @@
+#ifndef HSH_H
+#define HSH_H
+
+#include <stddef.h>
+
+/**
+ * hsh_sink_fn - Receives output of a shell session.
+ * @ctx: The context pointer given to hsh_session_create().
+ * @fd: 1 for standard output, 2 for standard error.
+ * @buf: The bytes written.
+ * @len: Number of bytes in @buf.
+ */
+typedef void (*hsh_sink_fn)(void *ctx, int fd, const char *buf, size_t len);
+
+/* A shell session: the data_t of one independent interpreter */
+typedef struct data_t hsh_session_t;
+
+hsh_session_t *hsh_session_create(hsh_sink_fn sink, void *ctx);
+int hsh_session_eval(hsh_session_t *session, const char *line);
+int hsh_session_setenv(hsh_session_t *session, const char *name,
+		const char *value);
+void hsh_session_destroy(hsh_session_t *session);
+
+#endif /* HSH_H */
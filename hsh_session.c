@@ -0,0 +1,108 @@
+#include "shell.h"
+
+/**
+ * hsh_session_create - Creates a shell session for use as a library.
+ * @sink: Function receiving the session's output, or NULL to write to the
+ * process's standard output and error.
+ * @ctx: Context pointer passed to @sink.
+ *
+ * The session starts from the process environment. It reads no input of
+ * its own and loads no history.
+ *
+ * Return: The session, or NULL on error.
+ */
+
+hsh_session_t *hsh_session_create(hsh_sink_fn sink, void *ctx)
+{
+	data_t init[] = { INIT_SHELL_INFO };
+	data_t *data = malloc(sizeof(data_t));
+	int idx;
+
+	if (!data)
+		return (NULL);
+	*data = init[0];
+	data->fName = "hsh";
+	data->shellPid = getpid();
+	data->fdMap = malloc(sizeof(int) * SESSION_FDS);
+	if (!data->fdMap || (sink && openSink(data, sink, ctx) == -1))
+	{
+		free(data->fdMap);
+		free(data);
+		return (NULL);
+	}
+	for (idx = 0; idx < SESSION_FDS; idx++)
+		data->fdMap[idx] = (idx < 3) ? idx : -1;
+	if (sink)
+		data->fdMap[1] = FD_SINK_OUT, data->fdMap[2] = FD_SINK_ERR;
+	initEnvList(data);
+	return (data);
+}
+
+/**
+ * hsh_session_eval - Parses and runs a command line in a session.
+ * @data: The session.
+ * @line: The command line; it may hold several lines.
+ *
+ * The session's output is flushed before this returns. An exit command
+ * ends only the evaluation, not the session.
+ *
+ * Return: The exit status of the line (2 after a syntax error).
+ */
+
+int hsh_session_eval(hsh_session_t *data, const char *line)
+{
+	char *text = dupStr(line);
+
+	if (!text)
+		return (1);
+	data->lineCounter = ++data->inputLine;
+	data->execStat = 0;
+	if (evalCmdLine(data, text) == -2 && data->errorCode != -1)
+		data->execStat = data->errorCode;
+	data->unwind = 0;
+	free(text);
+	freeShellData(data, 0);
+	putChar(data, FLUSH_BUFFER_FLAG);
+	printErrChar(data, FLUSH_BUFFER_FLAG);
+	return (data->execStat);
+}
+
+/**
+ * hsh_session_setenv - Sets a variable in a session.
+ * @data: The session.
+ * @name: The variable's name.
+ * @value: Its value.
+ *
+ * Return: 0 on success, or 1 on allocation failure.
+ */
+
+int hsh_session_setenv(hsh_session_t *data, const char *name,
+		const char *value)
+{
+	return (initEnvVar(data, (char *)name, (char *)value));
+}
+
+/**
+ * hsh_session_destroy - Frees a session.
+ * @data: The session (may be NULL).
+ *
+ * Return: Nothing.
+ */
+
+void hsh_session_destroy(hsh_session_t *data)
+{
+	int idx;
+
+	if (!data)
+		return;
+	printErrChar(data, FLUSH_BUFFER_FLAG);
+	freeShellData(data, 1);
+	if (data->sink)
+	{
+		for (idx = 0; idx < 2; idx++)
+			close(data->sink->readFds[idx]), close(data->sink->writeFds[idx]);
+		free(data->sink);
+	}
+	free(data->fdMap);
+	free(data);
+}
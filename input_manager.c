@@ -1,102 +1,78 @@
 #include "shell.h"
 
 /**
- * readInputBuffer - Read and buffer input, handling chained commands.
+ * readInputLine - Reads one line of input.
  * @data: Pointer to the data_t struct.
- * @buffer: The address of the buffer to store the input.
- * @bufferSize: The address of the buffer size.
+ * @line: The address of the buffer to store the line in (replaced).
  *
- * This function reads input from stdin, processes it, and handles chained
- * commands by buffering them. It also handles signal interruptions.
+ * The trailing newline is removed and the line is added to the history.
  *
- * Return: The number of bytes read.
+ * Return: The length of the line, or -1 at the end of the input.
  */
 
-ssize_t readInputBuffer(data_t *data, char **buffer, size_t *bufferSize)
+ssize_t readInputLine(data_t *data, char **line)
 {
-	size_t bufferSize_ptr = 0;
-	ssize_t bytesRead = 0;
+	size_t bufferSize = 0;
+	ssize_t bytesRead;
 
-	if (!*bufferSize)
-	{
-		free(*buffer);
-		*buffer = NULL;
-		signal(SIGINT, handleSignalInterrupt);
+	free(*line);
+	*line = NULL;
+	signal(SIGINT, handleSignalInterrupt);
 #if USE_SYSTEM_GETLINE
-		bytesRead = getline(buffer, &bufferSize_ptr, stdin);
+	bytesRead = getline(line, &bufferSize, stdin);
 #else
-		bytesRead = getLine(data, buffer, &bufferSize_ptr);
+	bytesRead = getLine(data, line, &bufferSize);
 #endif
-		if (bytesRead > 0)
-		{
-			if ((*buffer)[bytesRead - 1] == '\n')
-			{
-				(*buffer)[bytesRead - 1] = '\0';
-				bytesRead--;
-			}
-			data->lineCounterFlag = 1;
-			removeComments(*buffer);
-			addToHistoryList(data, *buffer, data->historyCounter++);
-
-			if (isCommandChained(data, *buffer, bufferSize))
-			{
-				*bufferSize = bytesRead;
-				data->cmdBuf = buffer;
-			}
-		}
-	}
+	if (bytesRead <= 0)
+		return (-1);
+	if ((*line)[bytesRead - 1] == '\n')
+		(*line)[--bytesRead] = '\0';
+	data->inputLine++;
+	addToHistoryList(data, *line, data->historyCounter++);
 	return (bytesRead);
 }
 
 /**
- * getInput - Read and process user input, handling command chaining.
+ * readProgram - Reads and parses the next complete command.
  * @data: Pointer to the data_t struct.
+ * @prog: Where to store the parsed program (NULL after a syntax error).
  *
- * This function reads and processes user input, handling command chaining.
- * It returns the number of bytes read, excluding newline characters.
+ * Lines are read until they form a complete command, so compound commands
+ * such as loops may span several lines; "> " prompts for the next one.
  *
- * Return: The number of bytes read.
+ * Return: 0 on success or after a syntax error, or -1 at the end of the
+ * input.
  */
 
-ssize_t getInput(data_t *data)
+int readProgram(data_t *data, program_t **prog)
 {
-	static size_t currPos, startPos;
-	static size_t length;
-	ssize_t bytesRead = 0;
-	char **cmdBuf_ptr = &(data->arg);
-	static char *cmdBuf;
-	char *pos;
+	strbuf_t source = {NULL, 0, 0};
+	char *line = NULL;
+	int status = PARSE_INCOMPLETE, firstLine = data->inputLine + 1;
+	ssize_t length = 0;
 
-	printCharToDesc(FLUSH_BUFFER_FLAG, data->readDescriptor);
-	bytesRead = readInputBuffer(data, &cmdBuf, &length);
-	if (bytesRead == -1)
-		return (-1);
-	if (length)
+	*prog = NULL;
+	while (status == PARSE_INCOMPLETE)
 	{
-		startPos = currPos;
-		pos = cmdBuf + currPos;
-
-		handleCommandChaining(data, cmdBuf, &startPos, currPos, length);
-		while (startPos < length)
-		{
-			if (isCommandChained(data, cmdBuf, &startPos))
-				break;
-			startPos++;
-		}
-
-		currPos = startPos + 1;
-		if (currPos >= length)
+		if (handleInteractive(data))
 		{
-			currPos = length = 0;
-			data->cmdBufType = NORMAL_COMMAND;
+			traceChar(data, FLUSH_BUFFER_FLAG);
+			putStr(data, source.len ? "> " : "$ ");
 		}
-
-		*cmdBuf_ptr = pos;
-		return (strLength(pos));
+		putChar(data, FLUSH_BUFFER_FLAG);
+		printErrChar(data, FLUSH_BUFFER_FLAG);
+		length = readInputLine(data, &line);
+		if (length == -1)
+			break;
+		appendStrBuf(&source, line, length);
+		appendStrBuf(&source, "\n", 1);
+		status = parseProgram(data, source.buf, firstLine, prog);
 	}
-
-	*cmdBuf_ptr = cmdBuf;
-	return (bytesRead);
+	if (length == -1 && source.len)
+		printSyntaxErr(data, data->inputLine, NULL);
+	free(line);
+	free(source.buf);
+	return (length == -1 ? -1 : 0);
 }
 
 /**
@@ -114,10 +90,14 @@ ssize_t getInput(data_t *data)
 ssize_t readBuffer(data_t *data, char *buffer, size_t *sizeRead)
 {
 	ssize_t bytesRead = 0;
+	long start;
 
 	if (*sizeRead)
 		return (0);
+	start = STATS_BEGIN(data);
 	bytesRead = read(data->readDescriptor, buffer, READ_BUFFER_SIZE);
+	STATS_END(data, PHASE_READ, start);
+	STATS_ADD(data, STAT_SYSCALLS, 1);
 	if (bytesRead >= 0)
 		*sizeRead = bytesRead;
 	return (bytesRead);
@@ -131,48 +111,44 @@ ssize_t readBuffer(data_t *data, char *buffer, size_t *sizeRead)
  * @bufferSize: Size of the preallocated buffer if not NULL.
  *
  * This function reads the next line of input from STDIN, dynamically managing
- * the buffer to accommodate variable line lengths.
+ * the buffer to accommodate variable line lengths. A line that continues
+ * past the end of the read buffer is completed by further reads.
  *
- * Return: The number of bytes read.
+ * Return: The number of bytes read, or -1 at the end of the input.
  */
 
 int getLine(data_t *data, char **bufferPtr, size_t *bufferSize)
 {
-	static char buffer[READ_BUFFER_SIZE];
-	static size_t currPos, bufferLen;
-	ssize_t bytes = 0, resBytes = 0;
-	char *inBuf = NULL, *newInBuf = NULL, *newLinePos;
-	size_t itr;
+	inbuf_t *input = &data->input;
+	size_t resBytes = 0, itr;
+	char *inBuf = *bufferPtr, *newInBuf;
 
-	inBuf = *bufferPtr;
 	if (inBuf && bufferSize)
 		resBytes = *bufferSize;
-	if (currPos == bufferLen)
-		currPos = bufferLen = 0;
-
-	bytes = readBuffer(data, buffer, &bufferLen);
-	if (bytes == -1 || (bytes == 0 && bufferLen == 0))
-		return (-1);
-
-	newLinePos = findChar(buffer + currPos, '\n');
-	itr = newLinePos ? 1 + (unsigned int)(newLinePos - buffer) : bufferLen;
-	newInBuf = memRealloc(inBuf, resBytes, inBuf ? resBytes + itr : itr + 1);
-	if (!newInBuf)
-		return (inBuf ? (free(inBuf), -1) : -1);
-
-	if (resBytes)
-		concatSubstr(newInBuf, buffer + currPos, itr - currPos);
-	else
-		copySubstr(newInBuf, buffer + currPos, itr - currPos + 1);
-
-	resBytes += itr - currPos;
-	currPos = itr;
-	inBuf = newInBuf;
-
+	while (!resBytes || inBuf[resBytes - 1] != '\n')
+	{
+		if (input->pos == input->len)
+			input->pos = input->len = 0;
+		if (readBuffer(data, input->buf, &input->len) == -1 || !input->len)
+			break;
+		for (itr = input->pos; itr < input->len && input->buf[itr] != '\n';
+				itr++)
+			;
+		itr += (itr < input->len);
+		newInBuf = memRealloc(inBuf, inBuf ? resBytes + 1 : 0,
+				resBytes + itr - input->pos + 1);
+		if (!newInBuf)
+			return (inBuf ? (free(inBuf), -1) : -1);
+		inBuf = newInBuf;
+		copySubstr(inBuf + resBytes, input->buf + input->pos,
+				itr - input->pos + 1);
+		resBytes += itr - input->pos;
+		input->pos = itr;
+	}
 	if (bufferSize)
 		*bufferSize = resBytes;
 	*bufferPtr = inBuf;
-	return (resBytes);
+	return (resBytes ? (int)resBytes : -1);
 }
 
 /**
@@ -180,12 +156,13 @@ int getLine(data_t *data, char **bufferPtr, size_t *bufferSize)
  * resetting the prompt.
  * @signalNum: The signal number (unused).
  *
+ * The prompt is written directly, since the handler cannot know which
+ * session's output buffer it interrupted.
+ *
  * Return: Nothing.
  */
 
 void handleSignalInterrupt(__attribute__((unused)) int signalNum)
 {
-	putStr("\n");
-	putStr("$ ");
-	putChar(FLUSH_BUFFER_FLAG);
+	write(STDOUT_FILENO, "\n$ ", 3);
 }
@@ -0,0 +1,146 @@
+#include "shell.h"
+
+/**
+ * exitChild - Ends a child process running part of the shell's work.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Buffered output is written first, and an exit builtin's status wins
+ * over the status of the last command. _exit() is used so that a program
+ * embedding the shell does not have its stdio buffers flushed or its
+ * atexit handlers run twice.
+ *
+ * Return: Nothing; the process exits.
+ */
+
+void exitChild(data_t *data)
+{
+	putChar(data, FLUSH_BUFFER_FLAG);
+	printErrChar(data, FLUSH_BUFFER_FLAG);
+	traceChar(data, FLUSH_BUFFER_FLAG);
+	_exit(data->unwind == UNWIND_EXIT && data->errorCode != -1
+			? data->errorCode : data->execStat);
+}
+
+/**
+ * forkJob - Starts a child process with its output going to pipes.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @job: The free slot to run the child in.
+ *
+ * The caller flushes its buffered output first.
+ *
+ * Return: 0 in the child, the child's process ID in the parent, or -1 if
+ * the child could not be started.
+ */
+
+pid_t forkJob(data_t *data, par_job_t *job)
+{
+	int out[2], err[2], stdio[3] = {-1, -1, -1};
+	pid_t pid;
+	long start;
+
+	if (pipe(out) == -1)
+		return (-1);
+	if (pipe(err) == -1)
+	{
+		close(out[0]), close(out[1]);
+		return (-1);
+	}
+	fcntl(out[0], F_SETFD, FD_CLOEXEC);
+	fcntl(err[0], F_SETFD, FD_CLOEXEC);
+	traceChar(data, FLUSH_BUFFER_FLAG);
+	start = STATS_BEGIN(data);
+	pid = fork();
+	STATS_END(data, PHASE_SPAWN, start);
+	STATS_ADD(data, STAT_SYSCALLS, 1);
+	if (pid == 0)
+	{
+		stdio[1] = out[1], stdio[2] = err[1];
+		detachSink(data, stdio);
+		return (0);
+	}
+	close(out[1]), close(err[1]);
+	if (pid == -1)
+	{
+		close(out[0]), close(err[0]);
+		return (-1);
+	}
+	job->pid = pid;
+	job->fds[0] = out[0], job->fds[1] = err[0];
+	job->start = start;
+	return (pid);
+}
+
+/**
+ * collectOutput - Waits for output from the running jobs and stores it.
+ * @jobs: The job slots.
+ * @polls: Room for two pollfd entries per slot.
+ * @slots: Number of slots.
+ *
+ * A pipe that reaches its end is closed.
+ *
+ * Return: Nothing.
+ */
+
+void collectOutput(par_job_t *jobs, struct pollfd *polls, int slots)
+{
+	char buffer[READ_BUFFER_SIZE * 4];
+	par_job_t *job;
+	ssize_t bytes;
+	int idx;
+
+	for (idx = 0; idx < 2 * slots; idx++)
+	{
+		polls[idx].fd = jobs[idx / 2].fds[idx % 2];
+		polls[idx].events = POLLIN;
+		polls[idx].revents = 0;
+	}
+	if (poll(polls, 2 * slots, -1) == -1)
+		return;
+	for (idx = 0; idx < 2 * slots; idx++)
+	{
+		if (!polls[idx].revents)
+			continue;
+		job = jobs + idx / 2;
+		bytes = read(polls[idx].fd, buffer, sizeof(buffer));
+		if (bytes > 0)
+			appendStrBuf(idx % 2 ? &job->err : &job->out, buffer, bytes);
+		else
+		{
+			close(polls[idx].fd);
+			job->fds[idx % 2] = -1;
+		}
+	}
+}
+
+/**
+ * finishJobs - Reaps the jobs whose output is complete and prints it.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @jobs: The job slots.
+ * @slots: Number of slots.
+ * @failed: Incremented for each job that exits with a non-zero status.
+ *
+ * Each job's output is written in one piece, so the output of jobs running
+ * at the same time is never interleaved, and its exit status is left in
+ * its slot.
+ *
+ * Return: Number of jobs finished.
+ */
+
+int finishJobs(data_t *data, par_job_t *jobs, int slots, int *failed)
+{
+	int idx, done = 0;
+
+	for (idx = 0; idx < slots; idx++)
+	{
+		if (!jobs[idx].pid || jobs[idx].fds[0] != -1 || jobs[idx].fds[1] != -1)
+			continue;
+		jobs[idx].status = waitChild(data, jobs[idx].pid);
+		*failed += (jobs[idx].status != 0);
+		jobs[idx].pid = 0;
+		writeOut(data, STDOUT_FILENO, jobs[idx].out.buf, jobs[idx].out.len);
+		writeOut(data, STDERR_FILENO, jobs[idx].err.buf, jobs[idx].err.len);
+		jobs[idx].out.len = jobs[idx].err.len = 0;
+		done++;
+	}
+	return (done);
+}
@@ -0,0 +1,138 @@
+#include "shell.h"
+
+/**
+ * skipBlanks - Skips blanks, escaped newlines and comments.
+ * @parser: The parser state.
+ *
+ * An escaped newline at the very end of the text makes the parse
+ * incomplete, since the command continues on the next line.
+ *
+ * Return: Nothing.
+ */
+
+void skipBlanks(parser_t *parser)
+{
+	char *text = parser->text;
+
+	while (1)
+	{
+		if (text[parser->pos] == ' ' || text[parser->pos] == '\t')
+			parser->pos++;
+		else if (text[parser->pos] == '\\' && text[parser->pos + 1] == '\n')
+		{
+			parser->pos += 2, parser->line++;
+			if (!text[parser->pos] && parser->status == PARSE_OK)
+				parser->status = PARSE_INCOMPLETE;
+		}
+		else if (text[parser->pos] == '#')
+			while (text[parser->pos] && text[parser->pos] != '\n')
+				parser->pos++;
+		else
+			break;
+	}
+}
+
+/**
+ * lexOperator - Recognizes the operator at the current position.
+ * @parser: The parser state.
+ *
+ * Return: The operator's token (one of the TOK_* values), or 0 if the
+ * current position starts a word.
+ */
+
+int lexOperator(parser_t *parser)
+{
+	char *str = parser->text + parser->pos;
+	int tok = 0, length = 1;
+
+	if (*str == '\n')
+		tok = TOK_NEWLINE;
+	else if (*str == ';')
+		tok = (str[1] == ';') ? TOK_DSEMI : TOK_SEMI;
+	else if (*str == '&')
+		tok = (str[1] == '&') ? TOK_AND : TOK_AMP;
+	else if (*str == '|')
+		tok = (str[1] == '|') ? TOK_OR : TOK_PIPE;
+	else if (*str == '(')
+		tok = TOK_LPAREN;
+	else if (*str == ')')
+		tok = TOK_RPAREN;
+	if (tok == TOK_DSEMI || tok == TOK_AND || tok == TOK_OR)
+		length = 2;
+	if (tok)
+		parser->pos += length;
+	if (tok == TOK_NEWLINE)
+		parser->line++;
+	if (tok == TOK_NEWLINE && parser->docs)
+		readHereDocs(parser);
+	return (tok);
+}
+
+/**
+ * lexToken - Reads the next token into the parser state.
+ * @parser: The parser state.
+ *
+ * A word is copied into the program's arena as written, quotes included;
+ * quote removal happens when it is expanded. A word left inside quotes or
+ * an unterminated expansion at the end of the text makes the parse
+ * incomplete, as does a here-document still waiting for its body.
+ *
+ * Return: The token read (one of the TOK_* values).
+ */
+
+int lexToken(parser_t *parser)
+{
+	int length, unclosed, idx;
+
+	parser->word = NULL;
+	skipBlanks(parser);
+	parser->tokPos = parser->pos;
+	if (!parser->text[parser->pos])
+	{
+		if (parser->docs && parser->status == PARSE_OK)
+			parser->status = PARSE_INCOMPLETE;
+		return (parser->tok = TOK_EOF);
+	}
+	parser->tok = lexOperator(parser);
+	if (parser->tok || lexRedir(parser))
+		return (parser->tok);
+	length = scanWord(parser->text + parser->pos, " \t\n;&|()<>", &unclosed);
+	if (unclosed)
+	{
+		parser->status = PARSE_INCOMPLETE;
+		return (parser->tok = TOK_EOF);
+	}
+	parser->word = arenaStrN(parser->prog, parser->text + parser->pos, length);
+	if (!parser->word)
+		parser->status = PARSE_ERROR;
+	for (idx = 0; idx < length; idx++)
+		parser->line += (parser->text[parser->pos + idx] == '\n');
+	parser->pos += length;
+	return (parser->tok = parser->word ? TOK_WORD : TOK_EOF);
+}
+
+/**
+ * isWord - Checks if the current token is a given (reserved) word.
+ * @parser: The parser state.
+ * @word: The word to compare with.
+ *
+ * Return: 1 if it is, 0 otherwise.
+ */
+
+int isWord(parser_t *parser, char *word)
+{
+	return (parser->tok == TOK_WORD && !cmpStr(parser->word, word));
+}
+
+/**
+ * skipNewlines - Skips newline tokens.
+ * @parser: The parser state.
+ *
+ * Return: Nothing.
+ */
+
+void skipNewlines(parser_t *parser)
+{
+	while (parser->tok == TOK_NEWLINE)
+		lexToken(parser);
+}
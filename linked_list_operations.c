@@ -2,6 +2,7 @@
 
 /**
  * displayStrList - Prints only the string element of a item_t linked list.
+ * @data: Pointer to the data_t struct containing shell information.
  * @head: Pointer to the head node of the linked list.
  *
  * This function displays the string elements of the linked list pointed to
@@ -10,14 +11,14 @@
  * Return: The number of elements in the list.
  */
 
-size_t displayStrList(const item_t *head)
+size_t displayStrList(data_t *data, const item_t *head)
 {
 	size_t size = 0;
 
 	while (head)
 	{
-		putStr(head->string ? head->string : "(nil)");
-		putStr("\n");
+		putStr(data, head->string ? head->string : "(nil)");
+		putStr(data, "\n");
 		head = head->next;
 		size++;
 	}
@@ -2,6 +2,7 @@
 
 /**
  * displayList - Prints all elements of a item_t linked list.
+ * @data: Pointer to the data_t struct containing shell information.
  * @head: The pointer to the address of the head node.
  *
  * This function prints each element of the linked list.
@@ -9,17 +10,17 @@
  * Return: The size of the list.
  */
 
-size_t displayList(const item_t *head)
+size_t displayList(data_t *data, const item_t *head)
 {
 	size_t listSize = 0;
 
 	while (head)
 	{
-		putStr(convertNum(head->number, 10, 0));
-		putChar(':');
-		putChar(' ');
-		putStr(head->string ? head->string : "(nil)");
-		putStr("\n");
+		putStr(data, convertNum(data, head->number, 10, 0));
+		putChar(data, ':');
+		putChar(data, ' ');
+		putStr(data, head->string ? head->string : "(nil)");
+		putStr(data, "\n");
 		head = head->next;
 		listSize++;
 	}
@@ -1,5 +1,63 @@
 #include "shell.h"
 
+/**
+ * initSession - Prepares the shell to run commands.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @zygote: True to start the zygote that launches external commands.
+ *
+ * The environment is loaded, and statistics and the metrics file are turned
+ * on if the environment asks for them.
+ *
+ * Return: Nothing.
+ */
+
+void initSession(data_t *data, int zygote)
+{
+	if (zygote)
+		startZygote(data);
+	initEnvList(data);
+	if (getEnvironVar(data, "HSH_STATS="))
+		startStats(data);
+	startMetrics(data);
+}
+
+/**
+ * runMode - Runs the mode chosen by the first command-line argument.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @argc: Argument count.
+ * @argv: Argument vector.
+ *
+ * With "-c cmdline" the shell runs a command string, with "--jobs N
+ * script..." several scripts at once, and with "--serve" or "--client" it
+ * runs or uses a command server.
+ *
+ * Return: The mode's exit status (2 if "-c" has no command string), or -1
+ * if no mode is chosen and the shell reads commands from its input or a
+ * script.
+ */
+
+int runMode(data_t *data, int argc, char **argv)
+{
+	if (argc == 2 && !cmpStr(argv[1], "-c"))
+	{
+		printErrStr(data, data->fName);
+		printErrStr(data, ": 0: -c requires an argument\n");
+		printErrChar(data, FLUSH_BUFFER_FLAG);
+		return (2);
+	}
+	if (argc < 3)
+		return (-1);
+	if (!cmpStr(argv[1], "--jobs"))
+		return (initSession(data, 0), runScripts(data, argv + 2));
+	if (!cmpStr(argv[1], "-c"))
+		return (initSession(data, 1), runCmdString(data, argv + 2));
+	if (!cmpStr(argv[1], "--serve"))
+		return (serveShell(data, argv + 2));
+	if (!cmpStr(argv[1], "--client"))
+		return (runClient(data, argv + 2));
+	return (-1);
+}
+
 /**
  * main - Entry point
  * @argc: Argument count.
@@ -7,13 +65,14 @@
  *
  * This is the main function of the shell program. It initializes data
  * structures, processes command-line arguments, and executes the shell logic.
+ * The modes chosen by options are run by runMode().
  *
- * Return: 0 if successful, or 1 otherwise.
+ * Return: 0 if successful, or the exit status of the mode run.
  */
 
 int main(int argc, char **argv)
 {
-	int fileDesc = 2;
+	int fileDesc = 2, status;
 	data_t data[] = { INIT_SHELL_INFO };
 
 	asm ("mov %1, %0\n\t"
@@ -21,28 +80,19 @@ int main(int argc, char **argv)
 		 : "=r" (fileDesc)
 		 : "r" (fileDesc));
 
-	if (argc == 2)
+	data->fName = argv[0];
+	data->shellPid = getpid();
+	status = runMode(data, argc, argv);
+	if (status != -1)
+		return (status);
+	if (argc >= 2)
 	{
-		fileDesc = open(argv[1], O_RDONLY);
-		if (fileDesc == -1)
-		{
-			if (errno == EACCES)
-				exit(126);
-			if (errno == ENOENT)
-			{
-				printErrStr(argv[0]);
-				printErrStr(": 0: Cannot access ");
-				printErrStr(argv[1]);
-				printErrChar('\n');
-				printErrChar(FLUSH_BUFFER_FLAG);
-				exit(127);
-			}
-			return (EXIT_FAILURE);
-		}
-		data->readDescriptor = fileDesc;
+		data->readDescriptor = openScript(data, argv[1]);
+		data->posArgs = argv + 2;
+		data->posCount = argc - 2;
 	}
 
-	initEnvList(data);
+	initSession(data, 1);
 	loadHistoryFromFile(data);
 	runShell(data, argv);
 
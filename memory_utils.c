@@ -86,3 +86,36 @@ void freeStrArr(char **strArray)
 
 	free(temp);
 }
+
+/**
+ * appendStrBuf - Appends bytes to a growable buffer.
+ * @strBuf: The buffer to append to.
+ * @str: The bytes to append.
+ * @length: Number of bytes to append.
+ *
+ * The buffer doubles in size when it runs out of room and is always kept
+ * NUL-terminated.
+ *
+ * Return: 0 on success, or 1 on allocation failure.
+ */
+
+int appendStrBuf(strbuf_t *strBuf, const char *str, size_t length)
+{
+	size_t newSize = strBuf->size ? strBuf->size : 256;
+	char *newBuf;
+
+	while (strBuf->len + length + 1 > newSize)
+		newSize *= 2;
+	if (newSize != strBuf->size)
+	{
+		newBuf = memRealloc(strBuf->buf, strBuf->size, newSize);
+		if (!newBuf)
+			return (1);
+		strBuf->buf = newBuf;
+		strBuf->size = newSize;
+	}
+	while (length--)
+		strBuf->buf[strBuf->len++] = *str++;
+	strBuf->buf[strBuf->len] = '\0';
+	return (0);
+}
@@ -0,0 +1,125 @@
+#include "shell.h"
+
+/**
+ * startMetrics - Sets up the metrics file if HSH_METRICS_FILE is set.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * The file is written from the statistics the stats built-in prints, so
+ * they are turned on. With HSH_METRICS_INTERVAL=N it is also rewritten
+ * after the first command that ends N seconds or more after the last
+ * write.
+ *
+ * Return: Nothing.
+ */
+
+void startMetrics(data_t *data)
+{
+	char *path = getEnvironVar(data, "HSH_METRICS_FILE=");
+	char *interval = getEnvironVar(data, "HSH_METRICS_INTERVAL=");
+
+	if (!path || (!data->stats && startStats(data)))
+		return;
+	data->metrics.path = dupStr(path);
+	data->metrics.owner = getpid();
+	if (interval && errStrToInt(interval) > 0)
+	{
+		data->metrics.interval = errStrToInt(interval) * 1000000000L;
+		data->metrics.due = nowNanos() + data->metrics.interval;
+	}
+}
+
+/**
+ * countCommand - Records a finished command for the statistics.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @start: When the command started, from nowNanos().
+ * @builtin: True if the command was a builtin, false if it was external.
+ *
+ * Only called while statistics are on.
+ *
+ * Return: Nothing.
+ */
+
+void countCommand(data_t *data, long start, int builtin)
+{
+	stats_t *stats = data->stats;
+	long now = nowNanos();
+
+	stats->counters[STAT_COMMANDS]++;
+	stats->counters[builtin ? STAT_BUILTIN_TIME : STAT_EXTERNAL_TIME] +=
+		now - start;
+	if (data->execStat)
+		stats->failures[data->execStat & 255]++;
+	if (data->metrics.interval && now >= data->metrics.due)
+	{
+		data->metrics.due = now + data->metrics.interval;
+		writeMetrics(data);
+	}
+}
+
+/**
+ * countStages - Records the stages of a pipeline that ran in child
+ * processes, which the shell cannot count command by command.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @pids: The process ID of each stage, or 0 for stages run in-process.
+ * @count: Number of stages.
+ * @start: When the pipeline started, from nowNanos().
+ *
+ * Each forked stage counts as one external command, and the pipeline's
+ * elapsed time as external time. Only called while statistics are on.
+ *
+ * Return: Nothing.
+ */
+
+void countStages(data_t *data, pid_t *pids, int count, long start)
+{
+	stats_t *stats = data->stats;
+	int idx, forked = 0;
+
+	for (idx = 0; idx < count; idx++)
+		forked += (pids[idx] != 0);
+	if (!forked)
+		return;
+	stats->counters[STAT_COMMANDS] += forked;
+	stats->counters[STAT_EXTERNAL_TIME] += nowNanos() - start;
+	if (pids[count - 1] && data->execStat)
+		stats->failures[data->execStat & 255]++;
+}
+
+/**
+ * writeMetrics - Writes the metrics file.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * The metrics are written to PATH.tmp, which is then renamed over PATH, so
+ * a collector never reads a partly written file. Failures are ignored;
+ * the next write tries again.
+ *
+ * Return: Nothing.
+ */
+
+void writeMetrics(data_t *data)
+{
+	strbuf_t text = {NULL, 0, 0}, tmpPath = {NULL, 0, 0};
+	char *path = data->metrics.path;
+	ssize_t bytes = 0;
+	size_t done = 0;
+	int fd = -1;
+
+	if (!path || !data->stats || getpid() != data->metrics.owner)
+		return;
+	if (!formatMetrics(data, &text)
+			&& !appendStrBuf(&tmpPath, path, strLength(path))
+			&& !appendStrBuf(&tmpPath, ".tmp", 4))
+		fd = open(tmpPath.buf, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	while (fd != -1 && done < text.len && bytes != -1)
+	{
+		bytes = write(fd, text.buf + done, text.len - done);
+		done += (bytes > 0) ? (size_t)bytes : 0;
+	}
+	if (fd != -1)
+	{
+		if (close(fd) || done < text.len || rename(tmpPath.buf, path))
+			unlink(tmpPath.buf);
+	}
+	free(text.buf);
+	free(tmpPath.buf);
+}
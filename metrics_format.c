@@ -0,0 +1,112 @@
+#include "shell.h"
+
+/**
+ * appendFixed - Appends a fixed-point number to a buffer.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @buf: The buffer.
+ * @value: The number, scaled by 10^@digits (at least 0).
+ * @digits: Number of decimal places.
+ *
+ * Return: 0 on success, or 1 on allocation failure.
+ */
+
+int appendFixed(data_t *data, strbuf_t *buf, long value, int digits)
+{
+	long scale = 1;
+	char *text;
+	int idx;
+
+	for (idx = 0; idx < digits; idx++)
+		scale *= 10;
+	text = convertNum(data, value / scale, 10, 0);
+	if (appendStrBuf(buf, text, strLength(text)))
+		return (1);
+	if (!digits)
+		return (0);
+	text = convertNum(data, value % scale + scale, 10, 0);
+	text[0] = '.';
+	return (appendStrBuf(buf, text, strLength(text)));
+}
+
+/**
+ * appendMetric - Appends one sample in the Prometheus text format.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @buf: The buffer.
+ * @type: The metric's type ("counter" or "gauge") to declare it first, or
+ * NULL for a further sample of a metric already declared.
+ * @name: The metric's name.
+ * @labels: The sample's labels, like "{code=\"1\"}", or "".
+ * @value: The value, scaled by 10^@digits.
+ * @digits: Number of decimal places.
+ *
+ * Return: 0 on success, or 1 on allocation failure.
+ */
+
+int appendMetric(data_t *data, strbuf_t *buf, char *type, char *name,
+		char *labels, long value, int digits)
+{
+	int err = 0;
+
+	if (type)
+	{
+		err |= appendStrBuf(buf, "# TYPE ", 7);
+		err |= appendStrBuf(buf, name, strLength(name));
+		err |= appendStrBuf(buf, " ", 1);
+		err |= appendStrBuf(buf, type, strLength(type));
+		err |= appendStrBuf(buf, "\n", 1);
+	}
+	err |= appendStrBuf(buf, name, strLength(name));
+	err |= appendStrBuf(buf, labels, strLength(labels));
+	err |= appendStrBuf(buf, " ", 1);
+	err |= appendFixed(data, buf, value, digits);
+	err |= appendStrBuf(buf, "\n", 1);
+	return (err);
+}
+
+/**
+ * formatMetrics - Formats the statistics for the metrics file.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @buf: The buffer to append the metrics to.
+ *
+ * Failures are counted by exit status; the PATH lookup figures are those
+ * of the command cache, and the time is split between builtins and
+ * external commands.
+ *
+ * Return: 0 on success, or 1 on allocation failure.
+ */
+
+int formatMetrics(data_t *data, strbuf_t *buf)
+{
+	long *counters = data->stats->counters, *failures = data->stats->failures;
+	long lookups = counters[STAT_CMD_HITS] + counters[STAT_CMD_MISSES];
+	char label[24];
+	int status, err;
+
+	err = appendMetric(data, buf, "counter", "hsh_commands_total", "",
+			counters[STAT_COMMANDS], 0);
+	err |= appendMetric(data, buf, "counter", "hsh_forks_total", "",
+			data->stats->phases[PHASE_SPAWN].count, 0);
+	err |= appendStrBuf(buf, "# TYPE hsh_command_failures_total counter\n",
+			strLength("# TYPE hsh_command_failures_total counter\n"));
+	for (status = 1; status < 256; status++)
+	{
+		if (!failures[status])
+			continue;
+		copyStr(label, "{code=\"");
+		concatStr(label, convertNum(data, status, 10, 0));
+		concatStr(label, "\"}");
+		err |= appendMetric(data, buf, NULL, "hsh_command_failures_total",
+				label, failures[status], 0);
+	}
+	err |= appendMetric(data, buf, "counter", "hsh_path_cache_hits_total", "",
+			counters[STAT_CMD_HITS], 0);
+	err |= appendMetric(data, buf, "counter", "hsh_path_cache_misses_total",
+			"", counters[STAT_CMD_MISSES], 0);
+	err |= appendMetric(data, buf, "gauge", "hsh_path_cache_hit_ratio", "",
+			lookups ? counters[STAT_CMD_HITS] * 1000000 / lookups : 0, 6);
+	err |= appendMetric(data, buf, "counter", "hsh_command_seconds_total",
+			"{kind=\"builtin\"}", counters[STAT_BUILTIN_TIME], 9);
+	err |= appendMetric(data, buf, NULL, "hsh_command_seconds_total",
+			"{kind=\"external\"}", counters[STAT_EXTERNAL_TIME], 9);
+	return (err);
+}
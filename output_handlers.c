@@ -2,6 +2,7 @@
 
 /**
  * printStrToDesc - Writes the provided string to a specified file descriptor.
+ * @data: Pointer to the data_t struct containing shell information.
  * @string: The string to be written.
  * @fileDescriptor: The file descriptor to write to.
  *
@@ -11,7 +12,7 @@
  * Return: The number of characters written.
  */
 
-int printStrToDesc(char *string, int fileDescriptor)
+int printStrToDesc(data_t *data, char *string, int fileDescriptor)
 {
 	int charsWritten = 0;
 
@@ -20,7 +21,7 @@ int printStrToDesc(char *string, int fileDescriptor)
 
 	while (*string)
 	{
-		charsWritten += printCharToDesc(*string++, fileDescriptor);
+		charsWritten += printCharToDesc(data, *string++, fileDescriptor);
 	}
 
 	return (charsWritten);
@@ -28,6 +29,7 @@ int printStrToDesc(char *string, int fileDescriptor)
 
 /**
  * printErrStr - Prints an error message string.
+ * @data: Pointer to the data_t struct containing shell information.
  * @errorMsg: The error message to be printed.
  *
  * This function is responsible for printing an error message,
@@ -36,7 +38,7 @@ int printStrToDesc(char *string, int fileDescriptor)
  * Return: Nothing.
  */
 
-void printErrStr(char *errorMsg)
+void printErrStr(data_t *data, char *errorMsg)
 {
 	int index = 0;
 
@@ -45,16 +47,18 @@ void printErrStr(char *errorMsg)
 
 	while (errorMsg[index] != '\0')
 	{
-		printErrChar(errorMsg[index]);
+		printErrChar(data, errorMsg[index]);
 		index++;
 	}
 }
 
 /**
  * printErrChar - Writes the character to stderr.
+ * @data: Pointer to the data_t struct containing shell information.
  * @character: The character to write.
  *
- * This function writes a character to the standard error (stderr).
+ * This function writes a character to the standard error (stderr) through
+ * the session's own buffer.
  * If @character is equal to the FLUSH_BUFFER_FLAG or the buffer is full,
  * it flushes the buffer to stderr.
  *
@@ -62,23 +66,23 @@ void printErrStr(char *errorMsg)
  * to errno.
  */
 
-int printErrChar(char character)
+int printErrChar(data_t *data, char character)
 {
-	static int index;
-	static char outputBuf[WRITE_BUFFER_SIZE];
+	outbuf_t *out = &data->err;
 
-	if (character == FLUSH_BUFFER_FLAG || index >= WRITE_BUFFER_SIZE)
+	if (character == FLUSH_BUFFER_FLAG || out->len >= WRITE_BUFFER_SIZE)
 	{
-		write(2, outputBuf, index);
-		index = 0;
+		writeOut(data, 2, out->buf, out->len);
+		out->len = 0;
 	}
 	if (character != FLUSH_BUFFER_FLAG)
-		outputBuf[index++] = character;
+		out->buf[out->len++] = character;
 	return (1);
 }
 
 /**
  * printCharToDesc - Writes a single character to a specified file descriptor.
+ * @data: Pointer to the data_t struct containing shell information.
  * @character: The character to be written.
  * @fileDescriptor: The file descriptor to which the character is written.
  *
@@ -89,17 +93,16 @@ int printErrChar(char character)
  * to errno.
  */
 
-int printCharToDesc(char character, int fileDescriptor)
+int printCharToDesc(data_t *data, char character, int fileDescriptor)
 {
-	static int index;
-	static char outputBuf[WRITE_BUFFER_SIZE];
+	outbuf_t *out = &data->fileOut;
 
-	if (character == FLUSH_BUFFER_FLAG || index >= WRITE_BUFFER_SIZE)
+	if (character == FLUSH_BUFFER_FLAG || out->len >= WRITE_BUFFER_SIZE)
 	{
-		write(fileDescriptor, outputBuf, index);
-		index = 0;
+		write(fileDescriptor, out->buf, out->len);
+		out->len = 0;
 	}
 	if (character != FLUSH_BUFFER_FLAG)
-		outputBuf[index++] = character;
+		out->buf[out->len++] = character;
 	return (1);
 }
@@ -0,0 +1,158 @@
+#include "shell.h"
+
+/**
+ * parseParallelOpts - Parses the options of the parallel built-in.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @slots: Set to the number of jobs to run at once (-j N, or one per
+ * online processor by default).
+ *
+ * Return: Index of the command in @data->argv, or -1 on error.
+ */
+
+int parseParallelOpts(data_t *data, int *slots)
+{
+	char **argv = data->argv, *value;
+	int idx = 1;
+
+	*slots = sysconf(_SC_NPROCESSORS_ONLN);
+	if (*slots < 1)
+		*slots = 1;
+	if (argv[1] && findPrefix(argv[1], "-j"))
+	{
+		value = argv[1][2] ? argv[1] + 2 : argv[2];
+		idx = argv[1][2] ? 2 : 3;
+		*slots = value ? errStrToInt(value) : -1;
+		if (*slots < 1)
+		{
+			printShellErr(data, "Illegal number: ");
+			printErrStr(data, value);
+			printErrChar(data, '\n');
+			return (-1);
+		}
+	}
+	if (argv[idx] && !cmpStr(argv[idx], "--"))
+		idx++;
+	return (idx);
+}
+
+/**
+ * readItems - Reads the items of the parallel built-in from standard
+ * input, one per line.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @items: Pointer to the vector receiving the items.
+ * @count: Pointer to the number of items.
+ * @size: Pointer to the number of slots allocated.
+ *
+ * Return: 0 on success, or 1 on allocation failure.
+ */
+
+int readItems(data_t *data, char ***items, int *count, int *size)
+{
+	read_state_t state = {{NULL, 0, 0}, '\n', -1, 0, 1, 0, 0};
+	int more = 1;
+
+	while (more)
+	{
+		state.out.len = 0;
+		more = readRecord(data, &state);
+		if (!more && !state.out.len)
+			break;
+		if (appendStrBuf(&state.out, "", 0)
+				|| pushArg(items, count, size, dupStr(state.out.buf)))
+		{
+			free(state.out.buf);
+			return (1);
+		}
+	}
+	free(state.out.buf);
+	return (0);
+}
+
+/**
+ * runParallel - Runs a command once per item, a bounded number at a time.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @words: The command words.
+ * @items: The items.
+ * @count: Number of items.
+ * @slots: Number of jobs to run at once.
+ *
+ * A new job starts as soon as one finishes, and the command is resolved
+ * once up front so no job searches PATH.
+ *
+ * Return: Number of jobs that failed, at most 101.
+ */
+
+int runParallel(data_t *data, char **words, char **items, int count,
+		int slots)
+{
+	par_job_t *jobs = malloc(sizeof(par_job_t) * slots);
+	struct pollfd *polls = malloc(sizeof(struct pollfd) * 2 * slots);
+	int next = 0, running = 0, failed = 0, idx;
+	resolved_t cmd;
+
+	if (!jobs || !polls)
+		return (free(jobs), free(polls), 1);
+	fillMemWithByte((char *)jobs, 0, sizeof(par_job_t) * slots);
+	resolveCommand(data, words[0], 1, &cmd);
+	putChar(data, FLUSH_BUFFER_FLAG);
+	printErrChar(data, FLUSH_BUFFER_FLAG);
+	while (next < count || running)
+	{
+		for (idx = 0; idx < slots && next < count; idx++)
+			if (!jobs[idx].pid)
+			{
+				failed += startJob(data, jobs + idx, words, items[next++]);
+				running += (jobs[idx].pid != 0);
+			}
+		if (running)
+			collectOutput(jobs, polls, slots);
+		running -= finishJobs(data, jobs, slots, &failed);
+	}
+	for (idx = 0; idx < slots; idx++)
+		free(jobs[idx].out.buf), free(jobs[idx].err.buf);
+	free(jobs);
+	free(polls);
+	return (failed > 101 ? 101 : failed);
+}
+
+/**
+ * parallelCmd - Runs a command for each of a list of items, several at a
+ * time (the parallel built-in).
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Usage: parallel [-j N] command [args] [::: items]. Without ::: the items
+ * are read from standard input, one per line. The output of each job is
+ * printed in one piece once the job finishes.
+ *
+ * Return: Number of jobs that failed (at most 101), or 2 on error.
+ */
+
+int parallelCmd(data_t *data)
+{
+	char **argv = data->argv, **items = NULL, *sep;
+	int slots, first, idx, count = 0, size = 0, status;
+
+	first = parseParallelOpts(data, &slots);
+	if (first < 0)
+		return (2);
+	for (idx = first; argv[idx] && cmpStr(argv[idx], ":::"); idx++)
+		;
+	if (idx == first)
+	{
+		printShellErr(data, "usage: parallel [-j N] command [::: items]\n");
+		return (2);
+	}
+	sep = argv[idx];
+	argv[idx] = NULL;
+	if (sep)
+		for (items = argv + idx + 1; items[count]; count++)
+			;
+	else if (readItems(data, &items, &count, &size))
+		count = 0;
+	status = runParallel(data, argv + first, items, count,
+			slots < count ? slots : (count ? count : 1));
+	argv[idx] = sep;
+	if (!sep)
+		freeStrArr(items);
+	return (status);
+}
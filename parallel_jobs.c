@@ -0,0 +1,88 @@
+#include "shell.h"
+
+/**
+ * jobArgv - Builds the argument vector of one parallel job.
+ * @words: The command words.
+ * @item: The job's input item.
+ *
+ * Each {} in a word is replaced with the item; if no word has one, the
+ * item is added as the last argument.
+ *
+ * Return: The vector, or NULL on allocation failure.
+ */
+
+char **jobArgv(char **words, char *item)
+{
+	char **args = NULL, *str;
+	int count = 0, size = 0, replaced = 0;
+	strbuf_t word;
+
+	for (; *words; words++)
+	{
+		word.buf = NULL;
+		word.len = word.size = 0;
+		for (str = *words; *str; str++)
+		{
+			if (str[0] == '{' && str[1] == '}')
+			{
+				appendStrBuf(&word, item, strLength(item));
+				replaced = 1, str++;
+			}
+			else
+				appendStrBuf(&word, str, 1);
+		}
+		if (pushArg(&args, &count, &size, word.buf ? word.buf : dupStr("")))
+			return (NULL);
+	}
+	if (!replaced && pushArg(&args, &count, &size, dupStr(item)))
+		return (NULL);
+	return (args);
+}
+
+/**
+ * runJob - Runs a parallel job in its child process.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @args: The job's argument vector.
+ *
+ * An executable replaces the child directly, so each job costs one
+ * process; builtins and functions run in the child itself.
+ *
+ * Return: Nothing; the child exits.
+ */
+
+void runJob(data_t *data, char **args)
+{
+	resolved_t cmd;
+
+	if (!args)
+		_exit(1);
+	data->argv = args;
+	for (data->argc = 0; args[data->argc]; data->argc++)
+		;
+	if (resolveCommand(data, args[0], 1, &cmd) == CMD_FILE)
+	{
+		execve(cmd.path, args, getEnv(data));
+		_exit(errno == EACCES ? 126 : 127);
+	}
+	runArgv(data);
+	exitChild(data);
+}
+
+/**
+ * startJob - Starts a parallel job with its output going to pipes.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @job: The free slot to run the job in.
+ * @words: The command words.
+ * @item: The job's input item.
+ *
+ * Return: 0 on success, or 1 if the job could not be started.
+ */
+
+int startJob(data_t *data, par_job_t *job, char **words, char *item)
+{
+	pid_t pid = forkJob(data, job);
+
+	if (pid == 0)
+		runJob(data, jobArgv(words, item));
+	return (pid == -1);
+}
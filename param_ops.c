@@ -0,0 +1,212 @@
+#include "shell.h"
+
+/**
+ * expandOperand - Expands the word operand of a parameter operator.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @str: The operand text (need not be NUL-terminated).
+ * @length: Length of the operand.
+ *
+ * Like expandPattern(), but the result is plain text.
+ *
+ * Return: The expanded operand (to be freed by the caller), or NULL.
+ */
+
+char *expandOperand(data_t *data, char *str, int length)
+{
+	return (removeEscapes(expandPattern(data, str, length)));
+}
+
+/**
+ * trimValue - Appends a value with a pattern removed from one end.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @value: The parameter value.
+ * @op: The operator: "#", "##", "%" or "%%".
+ * @pat: The pattern to remove.
+ *
+ * Return: Nothing.
+ */
+
+void trimValue(data_t *data, char *value, char *op, char *pat)
+{
+	int len = strLength(value), longest = (op[1] == op[0]), idx, step;
+
+	if (*op == '#')
+	{
+		idx = longest ? len : 0;
+		step = longest ? -1 : 1;
+		for (; idx >= 0 && idx <= len; idx += step)
+			if (matchPattern(pat, value, idx))
+				break;
+		if (idx >= 0 && idx <= len)
+			value += idx, len -= idx;
+	}
+	else
+	{
+		idx = longest ? 0 : len;
+		step = longest ? 1 : -1;
+		for (; idx >= 0 && idx <= len; idx += step)
+			if (matchPattern(pat, value + idx, len - idx))
+				break;
+		if (idx >= 0 && idx <= len)
+			len = idx;
+	}
+	appendExpBuf(data, value, len);
+}
+
+/**
+ * replaceValue - Appends a value with pattern matches replaced.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @value: The parameter value.
+ * @pat: The pattern to replace.
+ * @rep: The replacement string.
+ * @all: True to replace every match, false for the first one only.
+ *
+ * At each position the longest match is replaced.
+ *
+ * Return: Nothing.
+ */
+
+void replaceValue(data_t *data, char *value, char *pat, char *rep, int all)
+{
+	int len = strLength(value), pos = 0, end, done = 0;
+
+	while (pos <= len && *pat)
+	{
+		for (end = len; !done && end > pos; end--)
+			if (matchPattern(pat, value + pos, end - pos))
+				break;
+		if (done || end == pos)
+		{
+			if (pos < len)
+				appendExpBuf(data, value + pos, 1);
+			pos++;
+			continue;
+		}
+		appendExpBuf(data, rep, strLength(rep));
+		pos = end;
+		done = !all;
+	}
+	if (pos < len)
+		appendExpBuf(data, value + pos, len - pos);
+}
+
+/**
+ * defaultValue - Appends a value or its default, assigning it if asked.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @name: The parameter name.
+ * @nameLen: Length of @name.
+ * @value: The current value, or NULL if the parameter is unset.
+ * @op: The operator: ":-", "-", ":=" or "=".
+ * @arg: The expanded default, with the escapes of its quoted characters.
+ *
+ * A default that is not assigned keeps its quoted characters literal; an
+ * assigned one is substituted like the parameter's value.
+ *
+ * Return: Nothing.
+ */
+
+void defaultValue(data_t *data, char *name, int nameLen, char *value,
+		char *op, char *arg)
+{
+	size_t start = data->exp.len;
+	char *varName;
+
+	if (value && (*value || *op != ':'))
+		arg = value;
+	else if (op[*op == ':'] == '=' && isNameChar(*name, 1))
+	{
+		varName = malloc(nameLen + 1);
+		removeEscapes(arg);
+		if (varName)
+		{
+			copySubstr(varName, name, nameLen + 1);
+			initEnvVar(data, varName, arg);
+			free(varName);
+		}
+	}
+	else
+	{
+		appendStrBuf(&data->exp, arg, strLength(arg));
+		return;
+	}
+	appendExpBuf(data, arg, strLength(arg));
+	markFields(data, start);
+}
+
+/**
+ * applyParamOp - Expands ${name<op>word} for the supported operators.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @name: The parameter name.
+ * @nameLen: Length of @name.
+ * @op: The text following the name, up to the closing brace.
+ * @opLen: Length of @op.
+ *
+ * Supports :- - := = (defaults), # ## % %% (trimming) and / // (pattern
+ * replacement). All of them run in-process instead of forking sed,
+ * basename, dirname or expr. Results taken from the parameter's value are
+ * split into fields like a plain $name. Quoted characters of a pattern
+ * match only themselves; double quotes around the whole reference do not
+ * quote the pattern.
+ *
+ * Return: 0 on success, or 1 if the operator is not supported.
+ */
+
+int applyParamOp(data_t *data, char *name, int nameLen, char *op, int opLen)
+{
+	char *value = paramValue(data, name, nameLen), *arg, *rep = NULL;
+	int skip = 1 + (op[0] == ':' || (op[1] == op[0] && isDelim(*op, "#%/")));
+	int argLen = opLen - skip, slash = -1;
+	size_t base = data->exp.len;
+	int quoted = data->expQuoted & 2;
+
+	if (!isDelim(*op, ":-=#%/") || (*op == ':' && !isDelim(op[1], "-=")))
+		return (1);
+	if (*op == '/')
+		slash = findPatternEnd(op + skip, argLen, '/');
+	if (!isDelim(op[skip - 1], "-="))
+		data->expQuoted &= ~2;
+	arg = expandPattern(data, op + skip, slash < 0 ? argLen : slash);
+	if (slash >= 0)
+		rep = expandOperand(data, op + skip + slash + 1, argLen - slash - 1);
+	data->expQuoted |= quoted;
+	if (!arg)
+		return (free(rep), 1);
+	if (isDelim(op[skip - 1], "-="))
+		defaultValue(data, name, nameLen, value, op, arg);
+	else if (*op != '/')
+		trimValue(data, value ? value : "", op, arg);
+	else
+		replaceValue(data, value ? value : "", arg, rep ? rep : "",
+				skip == 2);
+	if (!isDelim(op[skip - 1], "-="))
+		markFields(data, base);
+	free(arg);
+	free(rep);
+	return (0);
+}
+
+/**
+ * expandError - Reports an expansion that failed.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @msg: The error message.
+ *
+ * The command being expanded is not run and its status is 2. An
+ * interactive shell skips the rest of the command line; any other shell
+ * exits. The message is written at once, after the output before it.
+ *
+ * Return: Nothing.
+ */
+
+void expandError(data_t *data, char *msg)
+{
+	putChar(data, FLUSH_BUFFER_FLAG);
+	printShellErr(data, msg);
+	printErrChar(data, FLUSH_BUFFER_FLAG);
+	data->execStat = 2;
+	data->unwind = UNWIND_ERROR;
+	if (!handleInteractive(data))
+	{
+		data->unwind = UNWIND_EXIT;
+		data->errorCode = 2;
+	}
+}
@@ -0,0 +1,109 @@
+#include "shell.h"
+
+/**
+ * paramNameLen - Measures the parameter name at the start of a string.
+ * @name: The text following '$' or "${".
+ *
+ * A name is either a single special parameter character (which includes
+ * a single digit) or a run of letters, digits and underscores not starting
+ * with a digit.
+ *
+ * Return: Length of the name, or 0 if @name does not start with one.
+ */
+
+int paramNameLen(char *name)
+{
+	int length = 0;
+
+	if (*name && isDelim(*name, "?$#@*0123456789"))
+		return (1);
+	while (isNameChar(name[length], !length))
+		length++;
+	return (length);
+}
+
+/**
+ * findBraceEnd - Finds the '}' closing a parameter expansion.
+ * @str: The text following "${".
+ * @dquoted: True if the expansion is inside double quotes, where single
+ * quotes in its word are literal.
+ *
+ * Nested ${...} references, command substitutions and quoted parts of the
+ * operator's word, as in ${u-"x}y"}, are skipped over.
+ *
+ * Return: Index of the closing brace, or -1 if there is none.
+ */
+
+int findBraceEnd(char *str, int dquoted)
+{
+	int idx, end, quote = 0;
+
+	for (idx = 0; str[idx]; idx++)
+	{
+		if (str[idx] == '\\' && str[idx + 1] && quote != '\'')
+			idx++;
+		else if (quote != '\'' && str[idx] == '$'
+				&& isDelim(str[idx + 1], "{("))
+		{
+			end = (str[idx + 1] == '{')
+				? findBraceEnd(str + idx + 2, dquoted || quote)
+				: findSubstEnd(str + idx + 2, 0);
+			if (end < 0)
+				return (-1);
+			idx += end + 2;
+		}
+		else if (quote)
+			quote = (str[idx] == quote) ? 0 : quote;
+		else if (str[idx] == '"' || (str[idx] == '\'' && !dquoted))
+			quote = str[idx];
+		else if (str[idx] == '}')
+			return (idx);
+	}
+	return (-1);
+}
+
+/**
+ * findPatternEnd - Finds an unescaped separator in an operator's word.
+ * @str: The word text (need not be NUL-terminated).
+ * @length: Length of @str.
+ * @separator: The separator character to look for.
+ *
+ * Separators escaped with '\' or inside nested ${...} are skipped.
+ *
+ * Return: Index of the separator, or -1 if there is none.
+ */
+
+int findPatternEnd(char *str, int length, char separator)
+{
+	int idx, depth = 0;
+
+	for (idx = 0; idx < length; idx++)
+	{
+		if (str[idx] == '\\' && idx + 1 < length)
+			idx++;
+		else if (str[idx] == '$' && str[idx + 1] == '{')
+			depth++, idx++;
+		else if (str[idx] == '}' && depth)
+			depth--;
+		else if (str[idx] == separator && !depth)
+			return (idx);
+	}
+	return (-1);
+}
+
+/**
+ * nameLength - Measures the variable name at the start of a string.
+ * @str: The string.
+ *
+ * Return: Length of the run of name characters (not starting with a
+ * digit) at the start of @str, 0 if there is none.
+ */
+
+int nameLength(char *str)
+{
+	int length = 0;
+
+	while (isNameChar(str[length], !length))
+		length++;
+	return (length);
+}
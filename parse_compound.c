@@ -0,0 +1,143 @@
+#include "shell.h"
+
+/**
+ * parseDoGroup - Parses the "do list done" body of a loop.
+ * @parser: The parser state.
+ *
+ * Return: The body, or NULL on error.
+ */
+
+node_t *parseDoGroup(parser_t *parser)
+{
+	node_t *body;
+
+	skipNewlines(parser);
+	if (!expectWord(parser, "do"))
+		return (NULL);
+	body = parseList(parser);
+	if (!body)
+		syntaxError(parser);
+	expectWord(parser, "done");
+	return (body);
+}
+
+/**
+ * parseIf - Parses an if statement, or the rest of one after "elif".
+ * @parser: The parser state.
+ *
+ * An elif part is stored as a nested if in the else branch.
+ *
+ * Return: The statement, or NULL on error.
+ */
+
+node_t *parseIf(parser_t *parser)
+{
+	node_t *node = newNode(parser, NODE_IF, NULL, NULL);
+
+	lexToken(parser);
+	if (!node)
+		return (NULL);
+	node->left = parseList(parser);
+	if (!node->left)
+		syntaxError(parser);
+	expectWord(parser, "then");
+	node->right = parseList(parser);
+	if (!node->right)
+		syntaxError(parser);
+	if (isWord(parser, "elif"))
+		node->next = parseIf(parser);
+	else
+	{
+		if (isWord(parser, "else"))
+		{
+			lexToken(parser);
+			node->next = parseList(parser);
+			if (!node->next)
+				syntaxError(parser);
+		}
+		expectWord(parser, "fi");
+	}
+	return (node);
+}
+
+/**
+ * parseLoop - Parses a while or until loop.
+ * @parser: The parser state.
+ *
+ * Return: The loop, or NULL on error.
+ */
+
+node_t *parseLoop(parser_t *parser)
+{
+	node_t *node = newNode(parser, isWord(parser, "while") ? NODE_WHILE
+			: NODE_UNTIL, NULL, NULL);
+
+	lexToken(parser);
+	if (!node)
+		return (NULL);
+	node->left = parseList(parser);
+	if (!node->left)
+		syntaxError(parser);
+	node->right = parseDoGroup(parser);
+	return (node);
+}
+
+/**
+ * parseFor - Parses a for loop.
+ * @parser: The parser state.
+ *
+ * Return: The loop, or NULL on error.
+ */
+
+node_t *parseFor(parser_t *parser)
+{
+	node_t *node = newNode(parser, NODE_FOR, NULL, NULL);
+	int size = 0;
+
+	lexToken(parser);
+	if (!node || parser->tok != TOK_WORD
+			|| nameLength(parser->word) != strLength(parser->word))
+	{
+		syntaxError(parser);
+		return (NULL);
+	}
+	node->name = parser->word;
+	lexToken(parser);
+	skipNewlines(parser);
+	if (isWord(parser, "in"))
+	{
+		lexToken(parser);
+		node->words = arenaAlloc(parser->prog, sizeof(char *));
+		while (parser->tok == TOK_WORD
+				&& !addWord(parser, &node->words, &node->count, &size))
+			lexToken(parser);
+		if (parser->tok != TOK_SEMI && parser->tok != TOK_NEWLINE)
+			syntaxError(parser);
+		lexToken(parser);
+	}
+	else if (parser->tok == TOK_SEMI)
+		lexToken(parser);
+	node->right = parseDoGroup(parser);
+	return (node);
+}
+
+/**
+ * parseGroup - Parses a "{ list; }" group.
+ * @parser: The parser state.
+ *
+ * Return: The group, or NULL on error.
+ */
+
+node_t *parseGroup(parser_t *parser)
+{
+	node_t *node = newNode(parser, NODE_GROUP, NULL, NULL);
+
+	lexToken(parser);
+	if (!node)
+		return (NULL);
+	node->left = parseList(parser);
+	if (!node->left)
+		syntaxError(parser);
+	expectWord(parser, "}");
+	return (node);
+}
@@ -0,0 +1,118 @@
+#include "shell.h"
+
+/**
+ * parseAfter - Parses the "after:a,b" word that makes a concurrent step
+ * wait for others.
+ * @parser: The parser state, at the word.
+ * @step: The step; the names it runs after are added to its words.
+ *
+ * Return: Nothing.
+ */
+
+void parseAfter(parser_t *parser, node_t *step)
+{
+	char *list = findPrefix(parser->word, "after:");
+	int size = 0, idx;
+
+	if (!*list)
+	{
+		parser->status = PARSE_ERROR;
+		return;
+	}
+	while (*list && parser->status == PARSE_OK)
+	{
+		for (idx = 0; list[idx] && list[idx] != ','; idx++)
+			;
+		parser->word = list;
+		list += idx + (list[idx] == ',');
+		parser->word[idx] = '\0';
+		if (idx)
+			addWord(parser, &step->words, &step->count, &size);
+	}
+	lexToken(parser);
+}
+
+/**
+ * parseStep - Parses one step of a concurrent block: an optional "name:"
+ * label, an optional "after:a,b" and an and-or list.
+ * @parser: The parser state.
+ *
+ * A step without a label is named after the first word of its first
+ * command.
+ *
+ * Return: The NODE_STEP, or NULL on error.
+ */
+
+node_t *parseStep(parser_t *parser)
+{
+	node_t *step = newNode(parser, NODE_STEP, NULL, NULL), *cmd;
+	int length = (parser->tok == TOK_WORD) ? strLength(parser->word) : 0;
+
+	if (!step)
+		return (NULL);
+	if (length > 1 && parser->word[length - 1] == ':')
+	{
+		step->name = parser->word;
+		step->name[length - 1] = '\0';
+		lexToken(parser);
+	}
+	if (parser->tok == TOK_WORD && findPrefix(parser->word, "after:"))
+		parseAfter(parser, step);
+	step->left = parseAndOr(parser);
+	if (parser->status != PARSE_OK)
+		return (NULL);
+	for (cmd = step->left; cmd && cmd->type != NODE_CMD && cmd->left;)
+		cmd = cmd->left;
+	if (!step->name && cmd && cmd->type == NODE_CMD && cmd->count)
+		step->name = cmd->words[0];
+	return (step);
+}
+
+/**
+ * parseConcurrent - Parses a "concurrent [-j N] { steps }" block.
+ * @parser: The parser state.
+ *
+ * Steps are separated by ';' or newlines, and the last one must be ended
+ * by one before the closing brace, as in a group.
+ *
+ * Return: The NODE_CONCURRENT, or NULL on error.
+ */
+
+node_t *parseConcurrent(parser_t *parser)
+{
+	node_t *node = newNode(parser, NODE_CONCURRENT, NULL, NULL), **link;
+
+	lexToken(parser);
+	if (!node)
+		return (NULL);
+	if (isWord(parser, "-j"))
+	{
+		lexToken(parser);
+		if (parser->tok != TOK_WORD
+				|| (node->count = errStrToInt(parser->word)) < 1)
+			syntaxError(parser);
+		else
+			lexToken(parser);
+	}
+	if (!expectWord(parser, "{"))
+		return (NULL);
+	skipNewlines(parser);
+	for (link = &node->left; parser->status == PARSE_OK
+			&& !isWord(parser, "}"); link = &(*link)->next)
+	{
+		*link = parseStep(parser);
+		if (!*link)
+			break;
+		if (parser->tok != TOK_SEMI && parser->tok != TOK_NEWLINE)
+		{
+			syntaxError(parser);
+			break;
+		}
+		lexToken(parser);
+		skipNewlines(parser);
+	}
+	if (!node->left)
+		syntaxError(parser);
+	expectWord(parser, "}");
+	return (node);
+}
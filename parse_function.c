@@ -0,0 +1,53 @@
+#include "shell.h"
+
+/**
+ * isFuncDef - Checks if the current word starts a function definition.
+ * @parser: The parser state.
+ *
+ * A function definition is a name followed by "()"; the parentheses have
+ * not been read as tokens yet, so the text after the word is looked at.
+ *
+ * Return: 1 if it does, 0 otherwise.
+ */
+
+int isFuncDef(parser_t *parser)
+{
+	char *text = parser->text;
+	int pos = parser->pos;
+
+	if (parser->tok != TOK_WORD
+			|| nameLength(parser->word) != strLength(parser->word))
+		return (0);
+	while (text[pos] == ' ' || text[pos] == '\t')
+		pos++;
+	if (text[pos++] != '(')
+		return (0);
+	while (text[pos] == ' ' || text[pos] == '\t')
+		pos++;
+	return (text[pos] == ')');
+}
+
+/**
+ * parseFuncDef - Parses a "name() command" function definition.
+ * @parser: The parser state.
+ *
+ * The body is parsed here, once, and kept in the program's arena; running
+ * the definition only records where the body is.
+ *
+ * Return: The definition, or NULL on error.
+ */
+
+node_t *parseFuncDef(parser_t *parser)
+{
+	node_t *node = newNode(parser, NODE_FUNC, NULL, NULL);
+
+	if (!node)
+		return (NULL);
+	node->name = parser->word;
+	lexToken(parser);
+	lexToken(parser);
+	lexToken(parser);
+	skipNewlines(parser);
+	node->left = parseCommand(parser);
+	return (node);
+}
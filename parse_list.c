@@ -0,0 +1,124 @@
+#include "shell.h"
+
+/**
+ * isListEnd - Checks if the current token ends a command list.
+ * @parser: The parser state.
+ *
+ * Return: 1 at the end of the text, an operator that cannot start a
+ * command or a reserved word closing a compound command, 0 otherwise.
+ */
+
+int isListEnd(parser_t *parser)
+{
+	char *word = parser->word;
+
+	if (parser->tok != TOK_WORD)
+		return (parser->tok != TOK_LPAREN && parser->tok != TOK_REDIR);
+	return (!cmpStr(word, "then") || !cmpStr(word, "else")
+			|| !cmpStr(word, "elif") || !cmpStr(word, "fi")
+			|| !cmpStr(word, "do") || !cmpStr(word, "done")
+			|| !cmpStr(word, "esac") || !cmpStr(word, "}"));
+}
+
+/**
+ * parseList - Parses a list of and-or lists separated by ';', '&' or
+ * newlines.
+ * @parser: The parser state.
+ *
+ * The list is built leaning right, so the executor walks it in a loop.
+ * Background jobs are not supported: a command ended by '&' is run in the
+ * foreground like one ended by ';'.
+ *
+ * Return: The list, or NULL if it is empty.
+ */
+
+node_t *parseList(parser_t *parser)
+{
+	node_t *list = NULL, **link = &list, *item;
+
+	skipNewlines(parser);
+	while (parser->status == PARSE_OK && !isListEnd(parser))
+	{
+		item = parseAndOr(parser);
+		if (list)
+		{
+			*link = newNode(parser, NODE_LIST, *link, item);
+			if (!*link)
+				break;
+			link = &(*link)->right;
+		}
+		else
+			list = item;
+		if (parser->tok != TOK_SEMI && parser->tok != TOK_AMP
+				&& parser->tok != TOK_NEWLINE)
+			break;
+		lexToken(parser);
+		skipNewlines(parser);
+	}
+	return (list);
+}
+
+/**
+ * parseAndOr - Parses pipelines joined by && and ||.
+ * @parser: The parser state.
+ *
+ * Return: The and-or list, or NULL on error.
+ */
+
+node_t *parseAndOr(parser_t *parser)
+{
+	node_t *node = parsePipeline(parser);
+	int type;
+
+	while (parser->status == PARSE_OK
+			&& (parser->tok == TOK_AND || parser->tok == TOK_OR))
+	{
+		type = (parser->tok == TOK_AND) ? NODE_AND : NODE_OR;
+		lexToken(parser);
+		skipNewlines(parser);
+		node = newNode(parser, type, node, parsePipeline(parser));
+	}
+	return (node);
+}
+
+/**
+ * parseCommand - Parses a simple or compound command, or a function
+ * definition.
+ * @parser: The parser state.
+ *
+ * Redirections after a compound command apply to the whole of it.
+ *
+ * Return: The command, or NULL on error.
+ */
+
+node_t *parseCommand(parser_t *parser)
+{
+	node_t *node;
+
+	if (parser->status != PARSE_OK || isListEnd(parser))
+	{
+		syntaxError(parser);
+		return (NULL);
+	}
+	if (isWord(parser, "if"))
+		node = parseIf(parser);
+	else if (isWord(parser, "while") || isWord(parser, "until"))
+		node = parseLoop(parser);
+	else if (isWord(parser, "for"))
+		node = parseFor(parser);
+	else if (isWord(parser, "case"))
+		node = parseCase(parser);
+	else if (isWord(parser, "{"))
+		node = parseGroup(parser);
+	else if (parser->tok == TOK_LPAREN)
+		node = parseSubshell(parser);
+	else if (isWord(parser, "concurrent"))
+		node = parseConcurrent(parser);
+	else if (isFuncDef(parser))
+		return (parseFuncDef(parser));
+	else
+		return (parseSimple(parser));
+	while (node && parser->status == PARSE_OK && parser->tok == TOK_REDIR)
+		parseRedir(parser, &node->redirs);
+	return (node);
+}
@@ -0,0 +1,61 @@
+#include "shell.h"
+
+/**
+ * parsePipeline - Parses commands joined by '|', optionally preceded by
+ * '!' or the reserved word "time".
+ * @parser: The parser state.
+ *
+ * The pipeline is built leaning right, one NODE_PIPE per '|', so the
+ * executor walks its stages in a loop.
+ *
+ * Return: The pipeline, or NULL on error.
+ */
+
+node_t *parsePipeline(parser_t *parser)
+{
+	node_t *node, **link;
+
+	if (isWord(parser, "!"))
+	{
+		lexToken(parser);
+		return (newNode(parser, NODE_NOT, parsePipeline(parser), NULL));
+	}
+	if (isWord(parser, "time"))
+	{
+		lexToken(parser);
+		return (newNode(parser, NODE_TIME, parsePipeline(parser), NULL));
+	}
+	node = parseCommand(parser);
+	for (link = &node; parser->status == PARSE_OK && parser->tok == TOK_PIPE;
+			link = &(*link)->right)
+	{
+		lexToken(parser);
+		skipNewlines(parser);
+		*link = newNode(parser, NODE_PIPE, *link, parseCommand(parser));
+		if (!*link)
+			break;
+	}
+	return (node);
+}
+
+/**
+ * parseSubshell - Parses a "( list )" subshell.
+ * @parser: The parser state.
+ *
+ * Return: The subshell, or NULL on error.
+ */
+
+node_t *parseSubshell(parser_t *parser)
+{
+	node_t *node = newNode(parser, NODE_SUBSHELL, NULL, NULL);
+
+	lexToken(parser);
+	if (!node)
+		return (NULL);
+	node->left = parseList(parser);
+	if (!node->left || parser->tok != TOK_RPAREN)
+		syntaxError(parser);
+	else
+		lexToken(parser);
+	return (node);
+}
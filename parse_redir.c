@@ -0,0 +1,184 @@
+#include "shell.h"
+
+/**
+ * lexRedir - Recognizes a redirection operator at the current position.
+ * @parser: The parser state.
+ *
+ * The operator may be preceded by the file descriptor it applies to, as
+ * in 2>&1; otherwise it applies to standard input or output.
+ *
+ * Return: TOK_REDIR, or 0 if the current position starts a word.
+ */
+
+int lexRedir(parser_t *parser)
+{
+	char *str = parser->text + parser->pos;
+	int digits = 0, fd = 0, length = 2, type;
+
+	while (str[digits] >= '0' && str[digits] <= '9' && digits < 4)
+		fd = fd * 10 + (str[digits++] - '0');
+	if (str[digits] != '<' && str[digits] != '>')
+		return (0);
+	str += digits;
+	if (findPrefix(str, "<<<") || findPrefix(str, "<<-"))
+		type = (str[2] == '<') ? REDIR_HERESTR : REDIR_HEREDOC_TABS, length = 3;
+	else if (findPrefix(str, "<<"))
+		type = REDIR_HEREDOC;
+	else if (findPrefix(str, "<&") || findPrefix(str, ">&"))
+		type = (*str == '<') ? REDIR_DUP_IN : REDIR_DUP_OUT;
+	else if (findPrefix(str, ">>"))
+		type = REDIR_APPEND;
+	else
+	{
+		type = (*str == '<') ? REDIR_IN : REDIR_OUT;
+		length = 1 + (str[1] == '|');
+	}
+	parser->redirType = type;
+	parser->redirFd = digits ? fd : (*str == '>');
+	parser->pos += digits + length;
+	return (parser->tok = TOK_REDIR);
+}
+
+/**
+ * hereDelim - Removes the quoting from a here-document delimiter.
+ * @parser: The parser state, with the delimiter as the current word.
+ * @quoted: Set to 1 if the delimiter had any quoting, 0 otherwise.
+ *
+ * Return: The delimiter (allocated in the arena), or NULL on failure.
+ */
+
+char *hereDelim(parser_t *parser, int *quoted)
+{
+	char *word = parser->word, *delim, *out, quote = 0;
+
+	delim = arenaStrN(parser->prog, word, strLength(word));
+	*quoted = 0;
+	for (out = delim; delim && *word; word++)
+	{
+		if (!quote && (*word == '\'' || *word == '"'))
+		{
+			quote = *word, *quoted = 1;
+			continue;
+		}
+		if (quote && *word == quote)
+		{
+			quote = 0;
+			continue;
+		}
+		if (*word == '\\' && quote != '\'' && word[1])
+			word++, *quoted = 1;
+		*out++ = *word;
+	}
+	if (delim)
+		*out = '\0';
+	return (delim);
+}
+
+/**
+ * parseRedir - Parses a redirection and appends it to a list.
+ * @parser: The parser state, with the operator as the current token.
+ * @redirs: Pointer to the list.
+ *
+ * A here-document is also queued so its body is read after the next
+ * newline.
+ *
+ * Return: 0 on success, or 1 on error.
+ */
+
+int parseRedir(parser_t *parser, redir_t **redirs)
+{
+	redir_t *redir = arenaAlloc(parser->prog, sizeof(redir_t)), **doc;
+	int quoted;
+
+	if (!redir)
+		return ((parser->status = PARSE_ERROR), 1);
+	redir->type = parser->redirType;
+	redir->fd = parser->redirFd;
+	lexToken(parser);
+	if (parser->tok != TOK_WORD)
+		return (syntaxError(parser), 1);
+	redir->word = parser->word;
+	if (redir->type == REDIR_HEREDOC || redir->type == REDIR_HEREDOC_TABS)
+	{
+		redir->word = hereDelim(parser, &quoted);
+		if (!redir->word)
+			return ((parser->status = PARSE_ERROR), 1);
+		redir->expand = !quoted;
+		for (doc = &parser->docs; *doc; doc = &(*doc)->nextDoc)
+			;
+		*doc = redir;
+	}
+	while (*redirs)
+		redirs = &(*redirs)->next;
+	*redirs = redir;
+	lexToken(parser);
+	return (0);
+}
+
+/**
+ * unescapeHereDoc - Removes the backslashes that quote $, `, \ or a
+ * newline from a here-document body.
+ * @body: The body (changed in place).
+ *
+ * Return: Nothing.
+ */
+
+void unescapeHereDoc(char *body)
+{
+	char *out = body;
+
+	for (; *body; body++)
+	{
+		if (*body == '\\' && isDelim(body[1], "$`\\\n") && *++body == '\n')
+			continue;
+		*out++ = *body;
+	}
+	*out = '\0';
+}
+
+/**
+ * readHereDocs - Reads the bodies of the pending here-documents.
+ * @parser: The parser state, just past a newline.
+ *
+ * Each body runs up to a line holding only its delimiter (after leading
+ * tabs, for <<-). A body without expansions is finished here, once, so
+ * running the command costs no expansion at all; the others are expanded
+ * each time the command runs.
+ *
+ * Return: Nothing.
+ */
+
+void readHereDocs(parser_t *parser)
+{
+	strbuf_t body = {NULL, 0, 0};
+	redir_t *doc;
+	char *line;
+	int length, found = 1;
+
+	while ((doc = parser->docs) && found)
+	{
+		parser->docs = doc->nextDoc;
+		body.len = found = 0;
+		while (!found && parser->text[parser->pos])
+		{
+			line = parser->text + parser->pos;
+			while (doc->type == REDIR_HEREDOC_TABS && *line == '\t')
+				line++;
+			for (length = 0; line[length] && line[length] != '\n'; length++)
+				;
+			found = (length == strLength(doc->word)
+					&& !cmpStrN(line, doc->word, length));
+			if (!found)
+				appendStrBuf(&body, line, length + (line[length] == '\n'));
+			parser->pos = line + length + (line[length] == '\n') - parser->text;
+			parser->line++;
+		}
+		doc->word = arenaStrN(parser->prog, body.buf ? body.buf : "", body.len);
+		if (doc->word && doc->expand && !findChar(doc->word, '$')
+				&& !findChar(doc->word, '`'))
+			unescapeHereDoc(doc->word), doc->expand = 0;
+	}
+	if (!found && parser->status == PARSE_OK)
+		parser->status = PARSE_INCOMPLETE;
+	free(body.buf);
+}
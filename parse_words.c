@@ -0,0 +1,144 @@
+#include "shell.h"
+
+/**
+ * addWord - Appends the current word to a word array in the arena.
+ * @parser: The parser state.
+ * @words: Pointer to the NULL-terminated array.
+ * @count: Pointer to the number of words in the array.
+ * @size: Pointer to the number of slots allocated.
+ *
+ * Return: 0 on success, or 1 on allocation failure.
+ */
+
+int addWord(parser_t *parser, char ***words, int *count, int *size)
+{
+	char **newWords;
+	int idx;
+
+	if (*count + 1 >= *size)
+	{
+		*size = *size ? *size * 2 : 8;
+		newWords = arenaAlloc(parser->prog, sizeof(char *) * *size);
+		if (!newWords)
+		{
+			parser->status = PARSE_ERROR;
+			return (1);
+		}
+		for (idx = 0; idx < *count; idx++)
+			newWords[idx] = (*words)[idx];
+		*words = newWords;
+	}
+	(*words)[(*count)++] = parser->word;
+	(*words)[*count] = NULL;
+	return (0);
+}
+
+/**
+ * parseSimple - Parses a simple command.
+ * @parser: The parser state.
+ *
+ * Redirections may appear anywhere among the words, or make up the whole
+ * command.
+ *
+ * Return: The command, or NULL on error.
+ */
+
+node_t *parseSimple(parser_t *parser)
+{
+	node_t *node;
+	int size = 0;
+
+	if (parser->tok != TOK_WORD && parser->tok != TOK_REDIR)
+	{
+		syntaxError(parser);
+		return (NULL);
+	}
+	node = newNode(parser, NODE_CMD, NULL, NULL);
+	while (node && parser->status == PARSE_OK)
+	{
+		if (parser->tok == TOK_REDIR)
+			parseRedir(parser, &node->redirs);
+		else if (parser->tok == TOK_WORD
+				&& !addWord(parser, &node->words, &node->count, &size))
+			lexToken(parser);
+		else
+			break;
+	}
+	return (node);
+}
+
+/**
+ * parseCaseItem - Parses one "pattern | pattern) list ;;" item of a case
+ * statement.
+ * @parser: The parser state.
+ *
+ * Return: The item, or NULL on error.
+ */
+
+node_t *parseCaseItem(parser_t *parser)
+{
+	node_t *item = newNode(parser, NODE_CASE_ITEM, NULL, NULL);
+	int size = 0;
+
+	if (!item)
+		return (NULL);
+	if (parser->tok == TOK_LPAREN)
+		lexToken(parser);
+	while (parser->tok == TOK_WORD
+			&& !addWord(parser, &item->words, &item->count, &size))
+	{
+		lexToken(parser);
+		if (parser->tok != TOK_PIPE)
+			break;
+		lexToken(parser);
+	}
+	if (!item->count || parser->tok != TOK_RPAREN)
+	{
+		syntaxError(parser);
+		return (NULL);
+	}
+	lexToken(parser);
+	item->right = parseList(parser);
+	if (parser->tok == TOK_DSEMI)
+	{
+		lexToken(parser);
+		skipNewlines(parser);
+	}
+	else if (!isWord(parser, "esac"))
+		syntaxError(parser);
+	return (item);
+}
+
+/**
+ * parseCase - Parses a case statement.
+ * @parser: The parser state.
+ *
+ * Return: The statement, or NULL on error.
+ */
+
+node_t *parseCase(parser_t *parser)
+{
+	node_t *node = newNode(parser, NODE_CASE, NULL, NULL), **link;
+
+	lexToken(parser);
+	if (!node || parser->tok != TOK_WORD)
+	{
+		syntaxError(parser);
+		return (NULL);
+	}
+	node->name = parser->word;
+	lexToken(parser);
+	skipNewlines(parser);
+	expectWord(parser, "in");
+	skipNewlines(parser);
+	link = &node->left;
+	while (parser->status == PARSE_OK && !isWord(parser, "esac"))
+	{
+		*link = parseCaseItem(parser);
+		if (!*link)
+			break;
+		link = &(*link)->next;
+	}
+	expectWord(parser, "esac");
+	return (node);
+}
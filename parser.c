@@ -0,0 +1,153 @@
+#include "shell.h"
+
+/**
+ * newNode - Allocates a tree node in the program's arena.
+ * @parser: The parser state.
+ * @type: The node type (one of the NODE_* values).
+ * @left: The node's first child.
+ * @right: The node's second child.
+ *
+ * Return: The new node, or NULL on allocation failure.
+ */
+
+node_t *newNode(parser_t *parser, int type, node_t *left, node_t *right)
+{
+	node_t *node = arenaAlloc(parser->prog, sizeof(node_t));
+
+	if (!node)
+	{
+		parser->status = PARSE_ERROR;
+		return (NULL);
+	}
+	node->type = type;
+	node->line = parser->line;
+	node->left = left;
+	node->right = right;
+	return (node);
+}
+
+/**
+ * syntaxError - Stops the parse at the current token.
+ * @parser: The parser state.
+ *
+ * Running out of text is not an error yet: the parse is incomplete and
+ * more input may finish it.
+ *
+ * Return: Nothing.
+ */
+
+void syntaxError(parser_t *parser)
+{
+	if (parser->status != PARSE_OK)
+		return;
+	if (parser->tok == TOK_EOF)
+	{
+		parser->status = PARSE_INCOMPLETE;
+		return;
+	}
+	parser->status = PARSE_ERROR;
+	if (parser->tok == TOK_NEWLINE)
+		parser->word = "newline";
+	else if (parser->tok != TOK_WORD)
+		parser->word = arenaStrN(parser->prog, parser->text + parser->tokPos,
+				parser->pos - parser->tokPos);
+}
+
+/**
+ * expectWord - Consumes a reserved word that must come next.
+ * @parser: The parser state.
+ * @word: The reserved word.
+ *
+ * Return: 1 if it was there, 0 otherwise (the parse is then stopped).
+ */
+
+int expectWord(parser_t *parser, char *word)
+{
+	if (parser->status != PARSE_OK)
+		return (0);
+	if (!isWord(parser, word))
+	{
+		syntaxError(parser);
+		return (0);
+	}
+	lexToken(parser);
+	return (1);
+}
+
+/**
+ * printSyntaxErr - Reports a syntax error.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @line: The line the error was found on.
+ * @token: The unexpected token, or NULL for the end of the input.
+ *
+ * Return: Nothing.
+ */
+
+void printSyntaxErr(data_t *data, int line, char *token)
+{
+	printErrStr(data, data->fName);
+	printErrStr(data, ": ");
+	printDecimal(data, line, STDERR_FILENO);
+	printErrStr(data, ": Syntax error: ");
+	if (token)
+	{
+		printErrStr(data, "\"");
+		printErrStr(data, token);
+		printErrStr(data, "\" unexpected\n");
+	}
+	else
+		printErrStr(data, "end of file unexpected\n");
+	data->execStat = 2;
+}
+
+/**
+ * parseProgram - Parses source text into a command tree.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @text: The source text.
+ * @line: The line number @text starts on.
+ * @result: Where to store the program (NULL unless PARSE_OK is returned).
+ *
+ * The tree is built once and then run as often as needed; loop bodies are
+ * never tokenized again. Syntax errors are reported here.
+ *
+ * Return: PARSE_OK, PARSE_INCOMPLETE if @text ends in the middle of a
+ * command, or PARSE_ERROR.
+ */
+
+int parseProgram(data_t *data, char *text, int line, program_t **result)
+{
+	parser_t parser;
+	node_t *root;
+	arena_block_t *block;
+	long start = STATS_BEGIN(data);
+
+	*result = NULL;
+	parser.data = data;
+	parser.prog = newProgram();
+	if (!parser.prog)
+		return (PARSE_ERROR);
+	parser.text = text;
+	parser.pos = 0;
+	parser.line = line;
+	parser.status = PARSE_OK;
+	parser.docs = NULL;
+	lexToken(&parser);
+	root = parseList(&parser);
+	if (parser.tok != TOK_EOF)
+		syntaxError(&parser);
+	if (parser.status == PARSE_ERROR)
+		printSyntaxErr(data, parser.line, parser.word);
+	if (parser.status != PARSE_OK)
+		releaseProgram(parser.prog);
+	else
+	{
+		parser.prog->root = root;
+		*result = parser.prog;
+		STATS_ADD(data, STAT_ALLOCS, 1);
+		for (block = parser.prog->arena; data->stats && block;
+				block = block->next)
+			STATS_ADD(data, STAT_ALLOCS, 1);
+	}
+	STATS_END(data, PHASE_PARSE, start);
+	return (parser.status);
+}
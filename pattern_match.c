@@ -0,0 +1,166 @@
+#include "shell.h"
+
+/**
+ * matchBracket - Matches a character against a [...] bracket expression.
+ * @pat: Pointer to the opening '['.
+ * @character: The character to test.
+ * @matched: Set to 1 if @character is in the set, 0 otherwise.
+ *
+ * Supports ranges (a-z) and negation with a leading '!' or '^'. A ']'
+ * directly after the opening bracket (or its negation) is taken literally.
+ *
+ * Return: Length of the bracket expression, or 0 if it is not terminated
+ * (the '[' is then an ordinary character).
+ */
+
+int matchBracket(char *pat, char character, int *matched)
+{
+	int idx = 1, negate = 0, found = 0;
+
+	if (pat[idx] == '!' || pat[idx] == '^')
+		negate = 1, idx++;
+	if (pat[idx] == ']')
+		found |= (character == ']'), idx++;
+	while (pat[idx] && pat[idx] != ']')
+	{
+		if (pat[idx + 1] == '-' && pat[idx + 2] && pat[idx + 2] != ']')
+		{
+			found |= (character >= pat[idx] && character <= pat[idx + 2]);
+			idx += 3;
+		}
+		else
+			found |= (character == pat[idx++]);
+	}
+	if (!pat[idx])
+		return (0);
+	*matched = found ^ negate;
+	return (idx + 1);
+}
+
+/**
+ * matchElem - Matches one character against one pattern element.
+ * @pat: The pattern element ('?', a bracket expression, an escaped or a
+ * literal character). Must not be '*' or the end of the pattern.
+ * @character: The character to test.
+ * @matched: Set to 1 if the element matches @character, 0 otherwise.
+ *
+ * Return: Length of the pattern element.
+ */
+
+int matchElem(char *pat, char character, int *matched)
+{
+	int length;
+
+	if (*pat == '?')
+	{
+		*matched = 1;
+		return (1);
+	}
+	if (*pat == '[')
+	{
+		length = matchBracket(pat, character, matched);
+		if (length)
+			return (length);
+	}
+	if (*pat == '\\' && pat[1])
+	{
+		*matched = (character == pat[1]);
+		return (2);
+	}
+	*matched = (character == *pat);
+	return (1);
+}
+
+/**
+ * matchPattern - Matches a string against a shell pattern.
+ * @pat: The pattern, using '*', '?', '[...]' and '\' escapes.
+ * @str: The string to match (need not be NUL-terminated).
+ * @length: Number of characters of @str to match.
+ *
+ * The whole of @str must match the whole pattern. Only the most recent '*'
+ * is ever retried, so matching never backtracks exponentially: the cost is
+ * at most proportional to the product of the two lengths.
+ *
+ * Return: 1 if the string matches, 0 otherwise.
+ */
+
+int matchPattern(char *pat, char *str, int length)
+{
+	char *starPat = NULL;
+	int idx = 0, starIdx = 0, elemLen, matched;
+
+	while (idx < length)
+	{
+		if (*pat == '*')
+		{
+			while (*pat == '*')
+				pat++;
+			starPat = pat;
+			starIdx = idx;
+			continue;
+		}
+		if (*pat)
+		{
+			elemLen = matchElem(pat, str[idx], &matched);
+			if (matched)
+			{
+				pat += elemLen;
+				idx++;
+				continue;
+			}
+		}
+		if (!starPat)
+			return (0);
+		pat = starPat;
+		idx = ++starIdx;
+	}
+	while (*pat == '*')
+		pat++;
+	return (!*pat);
+}
+
+/**
+ * hasGlobChars - Checks if a string contains unescaped pattern characters.
+ * @str: The string to check.
+ *
+ * A '[' only counts when a ']' follows it, so words such as "[" stay
+ * literal.
+ *
+ * Return: 1 if @str contains '*', '?' or '[...]', 0 otherwise.
+ */
+
+int hasGlobChars(char *str)
+{
+	for (; *str; str++)
+	{
+		if (*str == '\\' && str[1])
+			str++;
+		else if (*str == '*' || *str == '?'
+				|| (*str == '[' && findChar(str + 1, ']')))
+			return (1);
+	}
+	return (0);
+}
+
+/**
+ * removeEscapes - Removes the backslashes that make characters literal in
+ * an expanded word, once it is no longer used as a pattern.
+ * @str: The word, changed in place.
+ *
+ * Return: @str.
+ */
+
+char *removeEscapes(char *str)
+{
+	char *in = str, *out = str;
+
+	while (in && *in)
+	{
+		if (*in == '\\' && in[1])
+			in++;
+		*out++ = *in++;
+	}
+	if (out)
+		*out = '\0';
+	return (str);
+}
@@ -0,0 +1,178 @@
+#include "shell.h"
+
+/**
+ * forkNode - Runs a command tree in a child process.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The tree.
+ * @fds: Descriptors to make the child's standard input and output (-1 to
+ * leave one alone), then one more for the child to close (or -1).
+ *
+ * Return: The child's process ID, or -1 on error.
+ */
+
+pid_t forkNode(data_t *data, node_t *node, int *fds)
+{
+	pid_t pid;
+	long start;
+
+	putChar(data, FLUSH_BUFFER_FLAG);
+	printErrChar(data, FLUSH_BUFFER_FLAG);
+	traceChar(data, FLUSH_BUFFER_FLAG);
+	start = STATS_BEGIN(data);
+	pid = fork();
+	STATS_END(data, PHASE_SPAWN, start);
+	STATS_ADD(data, STAT_SYSCALLS, 1);
+	if (pid == -1)
+		perror("Error:");
+	if (pid == 0)
+	{
+		if (fds[2] != -1)
+			close(fds[2]);
+		fds[2] = -1;
+		detachSink(data, fds);
+		data->stdinRedirs += (fds[0] != -1);
+		setOutputCapture(data, NULL);
+		execNode(data, node);
+		exitChild(data);
+	}
+	return (pid);
+}
+
+/**
+ * waitChild - Waits for a child process to finish.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @pid: The child's process ID (-1 if it could not be started).
+ *
+ * The output of a library session's children is passed on meanwhile, and
+ * the resources the child used are added to the shell's totals.
+ *
+ * Return: The child's exit status (128 plus the signal number if it was
+ * killed).
+ */
+
+int waitChild(data_t *data, pid_t pid)
+{
+	struct rusage usage;
+	int status;
+	long start = STATS_BEGIN(data);
+
+	if (pid != -1 && data->sink)
+		drainSink(data, pid);
+	STATS_ADD(data, STAT_SYSCALLS, 1);
+	if (pid == -1 || wait4(pid, &status, 0, &usage) == -1)
+		return (1);
+	STATS_END(data, PHASE_WAIT, start);
+	addUsage(&data->children, &usage);
+	return (WIFEXITED(status) ? WEXITSTATUS(status)
+			: 128 + WTERMSIG(status));
+}
+
+/**
+ * runStage - Starts one stage of a pipeline.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @stage: The stage's command.
+ * @last: True for the last stage.
+ * @state: The pipeline state, which passes each stage's output on as the
+ * next stage's input.
+ *
+ * A stage made only of builtins runs in-process as a subshell and its
+ * output is kept in memory. Builtins never read their input, so the
+ * memory is only turned into a descriptor if an external stage follows.
+ *
+ * Return: The process ID of the child running the stage, 0 if it ran
+ * in-process, or -1 on error.
+ */
+
+pid_t runStage(data_t *data, node_t *stage, int last, pipe_state_t *state)
+{
+	int fds[3] = {-1, -1, -1}, pipeFds[2] = {-1, -1};
+	pid_t pid;
+
+	if (isBuiltinOnly(data, stage, BUILTIN_PURE | BUILTIN_SUBSHELL))
+	{
+		if (state->inFd != -1)
+			close(state->inFd);
+		state->inFd = -1;
+		state->out.len = 0;
+		runSubshell(data, stage, last ? NULL : &state->out);
+		state->buffered = !last;
+		return (0);
+	}
+	if (state->buffered)
+		state->inFd = hereDocFd(state->out.buf, state->out.len);
+	state->buffered = 0;
+	if (!last && pipe(pipeFds) == -1)
+		perror("Error:");
+	fds[0] = state->inFd;
+	fds[1] = pipeFds[1];
+	fds[2] = pipeFds[0];
+	pid = forkNode(data, stage, fds);
+	if (state->inFd != -1)
+		close(state->inFd);
+	if (pipeFds[1] != -1)
+		close(pipeFds[1]);
+	state->inFd = pipeFds[0];
+	return (pid);
+}
+
+/**
+ * execPipeline - Runs a pipeline.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The first NODE_PIPE of the pipeline.
+ *
+ * Every stage is started before any is waited for. The exit status is
+ * that of the last stage.
+ *
+ * Return: Nothing.
+ */
+
+void execPipeline(data_t *data, node_t *node)
+{
+	pipe_state_t state = {-1, {NULL, 0, 0}, 0};
+	node_t *stage;
+	pid_t *pids;
+	int count = 1, idx, status;
+	long start = STATS_BEGIN(data);
+
+	for (stage = node; stage->type == NODE_PIPE; stage = stage->right)
+		count++;
+	pids = malloc(sizeof(pid_t) * count);
+	if (!pids)
+	{
+		data->execStat = 1;
+		return;
+	}
+	for (idx = 0, stage = node; idx < count; idx++, stage = stage->right)
+		pids[idx] = runStage(data, idx < count - 1 ? stage->left : stage,
+				idx == count - 1, &state);
+	free(state.out.buf);
+	status = data->execStat;
+	for (idx = 0; idx < count - 1; idx++)
+		if (pids[idx])
+			waitChild(data, pids[idx]);
+	data->execStat = pids[count - 1] ? waitChild(data, pids[count - 1]) : status;
+	if (data->stats && start)
+		countStages(data, pids, count, start);
+	free(pids);
+}
+
+/**
+ * execSubshell - Runs a "( list )" subshell.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The subshell node.
+ *
+ * A list made only of builtins runs in-process against a snapshot of the
+ * shell state; anything else runs in a child process.
+ *
+ * Return: Nothing.
+ */
+
+void execSubshell(data_t *data, node_t *node)
+{
+	int fds[3] = {-1, -1, -1};
+
+	if (isBuiltinOnly(data, node->left, BUILTIN_PURE | BUILTIN_SUBSHELL))
+		runSubshell(data, node->left, NULL);
+	else
+		data->execStat = waitChild(data, forkNode(data, node->left, fds));
+}
@@ -0,0 +1,99 @@
+#include "shell.h"
+
+/**
+ * positionalValue - Finds the value of $#, $@, $* or a numbered parameter.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @name: The parameter name (need not be NUL-terminated).
+ * @length: Length of @name.
+ *
+ * $@ and $* are joined with spaces into a reusable buffer; this form is
+ * only used by operators such as ${@:-word}, plain references go through
+ * expandPositional().
+ *
+ * Return: The value, or NULL if the parameter is not set.
+ */
+
+char *positionalValue(data_t *data, const char *name, int length)
+{
+	int idx, number = 0;
+
+	if (*name == '#')
+		return (convertNum(data, data->posCount, 10, 0));
+	if (*name == '@' || *name == '*')
+	{
+		data->posJoin.len = 0;
+		for (idx = 0; idx < data->posCount; idx++)
+		{
+			if (idx)
+				appendStrBuf(&data->posJoin, " ", 1);
+			appendStrBuf(&data->posJoin, data->posArgs[idx],
+					strLength(data->posArgs[idx]));
+		}
+		return (data->posJoin.buf ? data->posJoin.buf : "");
+	}
+	for (idx = 0; idx < length; idx++)
+		number = number * 10 + (name[idx] - '0');
+	if (number < 1 || number > data->posCount)
+		return (NULL);
+	return (data->posArgs[number - 1]);
+}
+
+/**
+ * expandPositional - Expands $@ or $* into the expansion buffer.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @which: '@' or '*'.
+ *
+ * Parameters are separated by field separators so each one becomes its own
+ * argument, except for "$*", which joins them with spaces into one. Inside
+ * double quotes "$@" keeps empty parameters; outside, characters of IFS
+ * inside the parameters split them further.
+ *
+ * Return: Nothing.
+ */
+
+void expandPositional(data_t *data, char which)
+{
+	char separator = FIELD_SEPARATOR;
+	size_t start;
+	int idx, quoted = data->expQuoted & 2;
+
+	if (quoted)
+		separator = (which == '*') ? ' ' : FIELD_BREAK;
+	for (idx = 0; idx < data->posCount; idx++)
+	{
+		if (idx)
+			appendExpBuf(data, &separator, 1);
+		start = data->exp.len;
+		appendExpBuf(data, data->posArgs[idx], strLength(data->posArgs[idx]));
+		markFields(data, start);
+	}
+	if (separator != ' ' && (!quoted || data->posCount != 1))
+		data->expSplit = 1;
+}
+
+/**
+ * appendParam - Appends the value of a parameter to the expansion buffer.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @name: The parameter name (need not be NUL-terminated).
+ * @length: Length of @name.
+ *
+ * Unless it is inside double quotes, the value is split into fields.
+ *
+ * Return: Nothing.
+ */
+
+void appendParam(data_t *data, char *name, int length)
+{
+	size_t start = data->exp.len;
+	char *value;
+
+	if (length == 1 && (*name == '@' || *name == '*'))
+		expandPositional(data, *name);
+	else
+	{
+		value = paramValue(data, name, length);
+		if (value)
+			appendExpBuf(data, value, strLength(value));
+		markFields(data, start);
+	}
+}
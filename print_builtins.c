@@ -0,0 +1,49 @@
+#include "shell.h"
+
+/**
+ * echoCmd - Prints the arguments separated by spaces.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * A leading -n suppresses the trailing newline. Being a builtin, echo costs
+ * no process and can run inside command substitutions without forking.
+ *
+ * Return: 0 (Always).
+ */
+
+int echoCmd(data_t *data)
+{
+	int idx = 1, newline = 1;
+
+	if (data->argv[1] && !cmpStr(data->argv[1], "-n"))
+		newline = 0, idx++;
+	for (; data->argv[idx]; idx++)
+	{
+		putStr(data, data->argv[idx]);
+		if (data->argv[idx + 1])
+			putChar(data, ' ');
+	}
+	if (newline)
+		putChar(data, '\n');
+	return (0);
+}
+
+/**
+ * pwdCmd - Prints the current working directory.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: 0 on success, or 1 if the directory cannot be determined.
+ */
+
+int pwdCmd(data_t *data)
+{
+	char buffer[4096];
+
+	if (!getcwd(buffer, sizeof(buffer)))
+	{
+		printShellErr(data, "cannot determine current directory\n");
+		return (1);
+	}
+	putStr(data, buffer);
+	putChar(data, '\n');
+	return (0);
+}
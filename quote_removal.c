@@ -0,0 +1,107 @@
+#include "shell.h"
+
+/**
+ * expandDoubleQuoted - Expands a "..." string.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @str: Pointer to the opening double quote.
+ *
+ * Parameters, arithmetic and command substitutions are expanded inside,
+ * but their results are not split into fields. A backslash only escapes
+ * $, `, ", \ and newline.
+ *
+ * Return: Number of characters of @str consumed.
+ */
+
+int expandDoubleQuoted(data_t *data, char *str)
+{
+	int idx = 1, start = 1, outer = data->expQuoted & 2;
+
+	data->expQuoted |= 2;
+	while (str[idx] && str[idx] != '"')
+	{
+		if (str[idx] == '\\' && isDelim(str[idx + 1], "$`\"\\\n"))
+		{
+			appendExpBuf(data, str + start, idx - start);
+			if (str[idx + 1] != '\n')
+				appendExpBuf(data, str + idx + 1, 1);
+			start = idx += 2;
+		}
+		else if (str[idx] == '$' || str[idx] == '`')
+		{
+			appendExpBuf(data, str + start, idx - start);
+			start = idx += expandParam(data, str + idx);
+		}
+		else
+			idx++;
+	}
+	appendExpBuf(data, str + start, idx - start);
+	data->expQuoted = (data->expQuoted & ~2) | outer;
+	return (idx + (str[idx] == '"'));
+}
+
+/**
+ * expandQuoted - Removes the quoting at the start of a string.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @str: Pointer to a backslash, single quote or double quote.
+ *
+ * A backslash makes the next character literal (an escaped newline is
+ * removed), and '...' is copied as it is. Quoted characters stay literal
+ * when the word is expanded to pathnames or used as a pattern.
+ *
+ * Return: Number of characters of @str consumed.
+ */
+
+int expandQuoted(data_t *data, char *str)
+{
+	int idx = 1, outer = data->expQuoted & 2;
+
+	data->expQuoted |= 1;
+	if (*str == '"')
+		return (expandDoubleQuoted(data, str));
+	data->expQuoted |= 2;
+	if (*str == '\\')
+	{
+		if (str[1] && str[1] != '\n')
+			appendExpBuf(data, str + 1, 1);
+		data->expQuoted = (data->expQuoted & ~2) | outer;
+		return (1 + (str[1] != '\0'));
+	}
+	while (str[idx] && str[idx] != '\'')
+		idx++;
+	appendExpBuf(data, str + 1, idx - 1);
+	data->expQuoted = (data->expQuoted & ~2) | outer;
+	return (idx + (str[idx] == '\''));
+}
+
+/**
+ * expandPattern - Expands a word used as a pattern.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @str: The word (need not be NUL-terminated).
+ * @length: Length of the word.
+ *
+ * The word is expanded past the end of the text already in the expansion
+ * buffer, copied out, and the buffer is restored. Quoted pattern
+ * characters keep the backslash that makes them match only themselves.
+ *
+ * Return: The expanded word (to be freed by the caller), or NULL.
+ */
+
+char *expandPattern(data_t *data, char *str, int length)
+{
+	size_t base = data->exp.len;
+	char *word, *result;
+
+	word = malloc(length + 1);
+	if (!word)
+		return (NULL);
+	copySubstr(word, str, length + 1);
+	expandInto(data, word);
+	free(word);
+	result = dupStr(data->exp.buf + base);
+	for (word = result; word && *word; word++)
+		if (*word == FIELD_SEPARATOR || *word == FIELD_BREAK)
+			*word = ' ';
+	data->exp.len = base;
+	data->exp.buf[base] = '\0';
+	return (result);
+}
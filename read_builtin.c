@@ -0,0 +1,123 @@
+#include "shell.h"
+
+/**
+ * parseReadOpts - Parses the options of the read built-in.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @state: The record to configure.
+ *
+ * Accepts -r, -d DELIM and -n COUNT (the value may also be attached, as in
+ * -d: or -n5). An empty delimiter means a NUL byte.
+ *
+ * Return: Index of the first variable name in @data->argv, or -1 on error.
+ */
+
+int parseReadOpts(data_t *data, read_state_t *state)
+{
+	char **argv = data->argv, *value, opt;
+	int idx;
+
+	for (idx = 1; argv[idx] && argv[idx][0] == '-' && argv[idx][1]; idx++)
+	{
+		if (!cmpStr(argv[idx], "--"))
+			return (idx + 1);
+		if (!cmpStr(argv[idx], "-r"))
+		{
+			state->raw = 1;
+			continue;
+		}
+		opt = argv[idx][1];
+		value = argv[idx][2] ? argv[idx] + 2 : argv[idx + 1];
+		if (!isDelim(opt, "dn") || !value)
+		{
+			printShellErr(data, "Illegal option ");
+			printErrStr(data, argv[idx]);
+			printErrChar(data, '\n');
+			return (-1);
+		}
+		idx += !argv[idx][2];
+		if (opt == 'd')
+			state->delim = *value;
+		else if ((state->max = errStrToInt(value)) == -1)
+		{
+			printShellErr(data, "Illegal number: ");
+			printErrStr(data, value);
+			printErrChar(data, '\n');
+			return (-1);
+		}
+	}
+	return (idx);
+}
+
+/**
+ * assignReadFields - Splits a record into fields and assigns them.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @names: The NULL-terminated list of variable names.
+ * @line: The record (modified while it is split, then restored).
+ *
+ * Fields are separated by the characters in IFS (blank, tab and newline if
+ * it is unset). Runs of IFS whitespace count as one separator, and the
+ * last variable gets the rest of the record.
+ *
+ * Return: Nothing.
+ */
+
+void assignReadFields(data_t *data, char **names, char *line)
+{
+	char *ifs = lookupVar(data, "IFS", 3), *end, saved;
+
+	if (!ifs)
+		ifs = " \t\n";
+	for (; *names; names++)
+	{
+		while (*line && isDelim(*line, ifs) && isDelim(*line, " \t\n"))
+			line++;
+		end = line;
+		if (!names[1])
+		{
+			end += strLength(end);
+			while (end > line && isDelim(end[-1], ifs)
+					&& isDelim(end[-1], " \t\n"))
+				end--;
+		}
+		while (names[1] && *end && !isDelim(*end, ifs))
+			end++;
+		saved = *end;
+		*end = '\0';
+		initEnvVar(data, *names, line);
+		*end = saved;
+		line = end;
+		while (*line && isDelim(*line, ifs) && isDelim(*line, " \t\n"))
+			line++;
+		if (*line && isDelim(*line, ifs))
+			line++;
+	}
+}
+
+/**
+ * readCmd - Reads a record from standard input into variables.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * The record ends at a newline (or the -d delimiter) or after -n
+ * characters. Without variable names, it is stored in REPLY.
+ *
+ * Return: 0 on success, 1 at the end of the input, or 2 on error.
+ */
+
+int readCmd(data_t *data)
+{
+	read_state_t state = {{NULL, 0, 0}, '\n', -1, 0, 0, 0, 0};
+	char *reply[2] = {"REPLY", NULL};
+	int first, complete;
+
+	first = parseReadOpts(data, &state);
+	if (first < 0)
+		return (2);
+	putChar(data, FLUSH_BUFFER_FLAG);
+	complete = readRecord(data, &state);
+	if (appendStrBuf(&state.out, "", 0))
+		return (2);
+	assignReadFields(data, data->argv[first] ? data->argv + first : reply,
+			state.out.buf);
+	free(state.out.buf);
+	return (complete ? 0 : 1);
+}
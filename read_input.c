@@ -0,0 +1,133 @@
+#include "shell.h"
+
+/**
+ * readStep - Adds one input character to the record being read.
+ * @state: The record.
+ * @c: The character.
+ *
+ * Unless -r was given, a backslash makes the next character literal and a
+ * backslash-newline pair continues the record on the next line.
+ *
+ * Return: 1 if the record is complete, 0 if more input is needed.
+ */
+
+int readStep(read_state_t *state, char c)
+{
+	if (!state->escaped && !state->raw && c == '\\')
+	{
+		state->escaped = 1;
+		return (0);
+	}
+	if (!state->escaped && c == state->delim)
+		return (state->found = 1);
+	if (!state->escaped || c != '\n')
+	{
+		appendStrBuf(&state->out, &c, 1);
+		state->count++;
+	}
+	state->escaped = 0;
+	return (state->max >= 0 && state->count >= state->max);
+}
+
+/**
+ * readShellInput - Reads a record from the shell's own buffered input.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @state: The record.
+ *
+ * Used when standard input is also where the shell reads its commands
+ * from, so the two share one buffer and nothing is read twice or lost.
+ *
+ * Return: 1 if the record is complete, 0 at the end of the input.
+ */
+
+int readShellInput(data_t *data, read_state_t *state)
+{
+	inbuf_t *input = &data->input;
+
+	while (1)
+	{
+		if (input->pos == input->len)
+		{
+			input->pos = input->len = 0;
+			if (readBuffer(data, input->buf, &input->len) <= 0)
+				return (0);
+		}
+		if (readStep(state, input->buf[input->pos++]))
+			return (1);
+	}
+}
+
+/**
+ * readSeekable - Reads a record from a regular file in large blocks.
+ * @fd: The file descriptor.
+ * @state: The record.
+ *
+ * Whatever was read past the end of the record is given back with lseek(),
+ * so the next reader of @fd starts right after it.
+ *
+ * Return: 1 if the record is complete, 0 at the end of the file.
+ */
+
+int readSeekable(int fd, read_state_t *state)
+{
+	char buffer[READ_BUFFER_SIZE * 4];
+	ssize_t bytesRead, idx;
+
+	while ((bytesRead = read(fd, buffer, sizeof(buffer))) > 0)
+	{
+		for (idx = 0; idx < bytesRead; idx++)
+		{
+			if (readStep(state, buffer[idx]))
+			{
+				lseek(fd, idx + 1 - bytesRead, SEEK_CUR);
+				return (1);
+			}
+		}
+	}
+	return (0);
+}
+
+/**
+ * readBytewise - Reads a record one byte at a time.
+ * @fd: The file descriptor.
+ * @state: The record.
+ *
+ * Pipes and terminals cannot give back input read too far, so they are
+ * read a byte at a time to leave the rest for the next reader.
+ *
+ * Return: 1 if the record is complete, 0 at the end of the input.
+ */
+
+int readBytewise(int fd, read_state_t *state)
+{
+	char c;
+
+	while (read(fd, &c, 1) == 1)
+		if (readStep(state, c))
+			return (1);
+	return (0);
+}
+
+/**
+ * readRecord - Reads a record from standard input with the fewest system
+ * calls the input allows.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @state: The record.
+ *
+ * Return: 1 if the record is complete, 0 at the end of the input.
+ */
+
+int readRecord(data_t *data, read_state_t *state)
+{
+	struct stat info;
+	int fd;
+
+	if (state->max == 0)
+		return (1);
+	if (data->readDescriptor == STDIN_FILENO && !data->stdinRedirs)
+		return (readShellInput(data, state));
+	fd = sessionFd(data, STDIN_FILENO);
+	if (!fstat(fd, &info) && S_ISREG(info.st_mode))
+		return (readSeekable(fd, state));
+	return (readBytewise(fd, state));
+}
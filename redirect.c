@@ -0,0 +1,167 @@
+#include "shell.h"
+
+/**
+ * openRedir - Opens the file descriptor a redirection points at.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @redir: The redirection.
+ *
+ * The target word is expanded first. For N>&M and N<&M the descriptor is
+ * a copy of M, and a target of "-" closes N instead.
+ *
+ * Return: The new file descriptor, REDIR_CLOSE, or -1 on error.
+ */
+
+int openRedir(data_t *data, redir_t *redir)
+{
+	int fd, flags = O_WRONLY | O_CREAT | O_TRUNC;
+	char *target;
+
+	if (redir->type >= REDIR_HEREDOC)
+	{
+		fd = openHereDoc(data, redir);
+		if (fd == -1)
+			printShellErr(data, "cannot create here-document\n");
+		else if (data->unwind)
+			close(fd), fd = -1;
+		return (fd);
+	}
+	target = expandOperand(data, redir->word, strLength(redir->word));
+	if (!target || data->unwind)
+		return (free(target), -1);
+	STATS_ADD(data, STAT_SYSCALLS, 1);
+	if (redir->type == REDIR_DUP_IN || redir->type == REDIR_DUP_OUT)
+		fd = !cmpStr(target, "-") ? REDIR_CLOSE
+			: dupSessionFd(data, errStrToInt(target));
+	else
+	{
+		if (redir->type == REDIR_IN)
+			flags = O_RDONLY;
+		else if (redir->type == REDIR_APPEND)
+			flags = O_WRONLY | O_CREAT | O_APPEND;
+		fd = open(target, flags | O_CLOEXEC, 0666);
+	}
+	if (fd == -1)
+	{
+		if (redir->type == REDIR_DUP_IN || redir->type == REDIR_DUP_OUT)
+			printShellErr(data, "Bad fd number: ");
+		else
+			printShellErr(data, redir->type == REDIR_IN ? "cannot open "
+					: "cannot create ");
+		printErrStr(data, target);
+		printErrChar(data, '\n');
+	}
+	free(target);
+	return (fd);
+}
+
+/**
+ * applyRedirs - Applies a command's redirections in order.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @redir: The first redirection.
+ * @saved: Room for two ints per redirection, filled with each redirected
+ * descriptor and a copy of what it pointed at before (-1 if it was closed).
+ *
+ * The shell's buffered output is flushed first so it goes where it was
+ * written to. If a redirection fails, those applied are undone. A library
+ * session only changes its descriptor map (see mapRedirs()).
+ *
+ * Return: Number of redirections applied, or -1 on error.
+ */
+
+int applyRedirs(data_t *data, redir_t *redir, int *saved)
+{
+	int count, fd;
+
+	putChar(data, FLUSH_BUFFER_FLAG);
+	printErrChar(data, FLUSH_BUFFER_FLAG);
+	if (data->fdMap)
+		return (mapRedirs(data, redir, saved));
+	for (count = 0; redir; redir = redir->next, count++)
+	{
+		saved[2 * count] = redir->fd;
+		saved[2 * count + 1] = fcntl(redir->fd, F_DUPFD_CLOEXEC, 10);
+		data->stdinRedirs += (redir->fd == STDIN_FILENO);
+		fd = openRedir(data, redir);
+		if (fd == -1)
+		{
+			restoreRedirs(data, saved, count + 1);
+			return (-1);
+		}
+		if (fd == REDIR_CLOSE)
+			close(redir->fd);
+		else if (fd != redir->fd)
+		{
+			dup2(fd, redir->fd);
+			close(fd);
+		}
+		else
+			fcntl(fd, F_SETFD, 0);
+	}
+	return (count);
+}
+
+/**
+ * restoreRedirs - Undoes redirections, the last one first.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @saved: The descriptors saved by applyRedirs().
+ * @count: Number of redirections to undo.
+ *
+ * Return: Nothing.
+ */
+
+void restoreRedirs(data_t *data, int *saved, int count)
+{
+	putChar(data, FLUSH_BUFFER_FLAG);
+	printErrChar(data, FLUSH_BUFFER_FLAG);
+	if (data->fdMap)
+	{
+		unmapRedirs(data, saved, count);
+		return;
+	}
+	while (count--)
+	{
+		if (saved[2 * count + 1] == -1)
+			close(saved[2 * count]);
+		else
+		{
+			dup2(saved[2 * count + 1], saved[2 * count]);
+			close(saved[2 * count + 1]);
+		}
+		data->stdinRedirs -= (saved[2 * count] == STDIN_FILENO);
+	}
+}
+
+/**
+ * execRedirected - Runs a command with its redirections in effect.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The command node.
+ *
+ * The redirections are applied in the shell itself and undone afterwards,
+ * so built-ins and compound commands need no child process; external
+ * commands inherit them when they are forked.
+ *
+ * Return: The exit status of the command, or 2 if a redirection failed.
+ */
+
+int execRedirected(data_t *data, node_t *node)
+{
+	redir_t *redir;
+	int count = 0, *saved;
+
+	for (redir = node->redirs; redir; redir = redir->next)
+		count++;
+	saved = malloc(sizeof(int) * 2 * count);
+	if (!saved)
+		return (data->execStat = 2);
+	data->lineCounter = node->line;
+	count = applyRedirs(data, node->redirs, saved);
+	if (count < 0)
+		data->execStat = 2;
+	else
+	{
+		execCommand(data, node);
+		restoreRedirs(data, saved, count);
+	}
+	free(saved);
+	return (data->execStat);
+}
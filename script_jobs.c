@@ -0,0 +1,188 @@
+#include "shell.h"
+
+/**
+ * openScript - Opens a script named on the command line.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @path: The script's path.
+ *
+ * Return: The descriptor; the process exits if the file cannot be opened.
+ */
+
+int openScript(data_t *data, char *path)
+{
+	int fileDesc = open(path, O_RDONLY);
+
+	if (fileDesc != -1)
+		return (fileDesc);
+	if (errno == EACCES)
+		exit(126);
+	if (errno == ENOENT)
+	{
+		printErrStr(data, data->fName);
+		printErrStr(data, ": 0: Cannot access ");
+		printErrStr(data, path);
+		printErrChar(data, '\n');
+		printErrChar(data, FLUSH_BUFFER_FLAG);
+		exit(127);
+	}
+	exit(EXIT_FAILURE);
+}
+
+/**
+ * runScriptJob - Runs one script of "hsh --jobs" in its child process.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @path: The script's path.
+ *
+ * The child starts from the parent's state, with the environment already
+ * imported, and its standard input comes from /dev/null. The history file
+ * is neither read nor written.
+ *
+ * Return: Nothing; the child exits with the script's status.
+ */
+
+void runScriptJob(data_t *data, char *path)
+{
+	int null = open("/dev/null", O_RDONLY);
+
+	if (null > STDIN_FILENO)
+		dup2(null, STDIN_FILENO), close(null);
+	data->readDescriptor = openScript(data, path);
+	runPrograms(data);
+	exitChild(data);
+}
+
+/**
+ * reapScripts - Reports the scripts whose jobs have finished.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @jobs: The job slots.
+ * @slots: Number of slots.
+ * @scripts: The script paths.
+ *
+ * Return: Number of those scripts that failed.
+ */
+
+int reapScripts(data_t *data, par_job_t *jobs, int slots, char **scripts)
+{
+	int idx, failed = 0;
+
+	for (idx = 0; idx < slots; idx++)
+	{
+		if (jobs[idx].pid || jobs[idx].tag == -1)
+			continue;
+		data->execStat = jobs[idx].status;
+		if (data->stats && jobs[idx].start)
+			countCommand(data, jobs[idx].start, 0);
+		if (jobs[idx].status)
+		{
+			printErrStr(data, data->fName);
+			printErrStr(data, ": ");
+			printErrStr(data, scripts[jobs[idx].tag]);
+			printErrStr(data, ": exit status ");
+			printErrStr(data, convertNum(data, jobs[idx].status, 10, 0));
+			printErrChar(data, '\n');
+			failed++;
+		}
+		jobs[idx].tag = -1;
+	}
+	printErrChar(data, FLUSH_BUFFER_FLAG);
+	return (failed);
+}
+
+/**
+ * runScriptPool - Runs scripts a bounded number at a time.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @scripts: The script paths.
+ * @count: Number of scripts.
+ * @jobs: The free job slots.
+ * @slots: Number of slots.
+ *
+ * Return: Number of scripts that failed.
+ */
+
+int runScriptPool(data_t *data, char **scripts, int count, par_job_t *jobs,
+		int slots)
+{
+	struct pollfd *polls = malloc(sizeof(struct pollfd) * 2 * slots);
+	int next = 0, running = 0, failed = 0, unused = 0, idx;
+	pid_t pid;
+
+	if (!polls)
+		return (count);
+	while (next < count || running)
+	{
+		for (idx = 0; idx < slots && next < count; idx++)
+			if (jobs[idx].tag == -1)
+			{
+				jobs[idx].tag = next;
+				pid = forkJob(data, jobs + idx);
+				if (pid == 0)
+					runScriptJob(data, scripts[next]);
+				if (pid == -1)
+					jobs[idx].status = 1;
+				next++;
+			}
+		for (running = 0, idx = 0; idx < slots; idx++)
+			running += (jobs[idx].pid != 0);
+		if (running)
+			collectOutput(jobs, polls, slots);
+		finishJobs(data, jobs, slots, &unused);
+		failed += reapScripts(data, jobs, slots, scripts);
+	}
+	free(polls);
+	return (failed);
+}
+
+/**
+ * runScripts - Runs several scripts at once ("hsh --jobs N script...").
+ * @data: Pointer to the data_t struct containing shell information.
+ * @argv: The job limit followed by the script paths.
+ *
+ * Each script runs in its own child of one parent that has already started
+ * up, so the scripts share no state. Each script's output is printed in
+ * one piece when it finishes, failures are reported as they happen and a
+ * summary is printed at the end. For the statistics and the metrics file
+ * each script counts as one external command. The shell's data is freed
+ * before it returns.
+ *
+ * Return: Number of scripts that failed (at most 101), or 2 on error.
+ */
+
+int runScripts(data_t *data, char **argv)
+{
+	par_job_t *jobs;
+	int slots = errStrToInt(argv[0]), count, failed, idx;
+
+	for (count = 0; argv[count + 1]; count++)
+		;
+	if (slots < 1 || !count)
+	{
+		printErrStr(data, data->fName);
+		printErrStr(data, slots < 1 ? ": 0: Illegal number: " : ": 0: no scripts");
+		printErrStr(data, slots < 1 ? argv[0] : NULL);
+		printErrChar(data, '\n');
+		printErrChar(data, FLUSH_BUFFER_FLAG);
+		freeShellData(data, 1);
+		return (2);
+	}
+	slots = slots < count ? slots : count;
+	jobs = malloc(sizeof(par_job_t) * slots);
+	if (!jobs)
+		return (freeShellData(data, 1), 2);
+	fillMemWithByte((char *)jobs, 0, sizeof(par_job_t) * slots);
+	for (idx = 0; idx < slots; idx++)
+		jobs[idx].tag = -1;
+	failed = runScriptPool(data, argv + 1, count, jobs, slots);
+	for (idx = 0; idx < slots; idx++)
+		free(jobs[idx].out.buf), free(jobs[idx].err.buf);
+	free(jobs);
+	writeMetrics(data);
+	freeShellData(data, 1);
+	printErrStr(data, data->fName);
+	printErrStr(data, ": ");
+	printErrStr(data, convertNum(data, count, 10, 0));
+	printErrStr(data, " scripts, ");
+	printErrStr(data, convertNum(data, failed, 10, 0));
+	printErrStr(data, " failed\n");
+	printErrChar(data, FLUSH_BUFFER_FLAG);
+	return (failed > 101 ? 101 : failed);
+}
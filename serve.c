@@ -0,0 +1,121 @@
+#include "shell.h"
+
+/**
+ * sendToClient - Output sink of a request served by the command server.
+ * @ctx: Pointer to the connection's descriptor.
+ * @fd: 1 for standard output, 2 for standard error.
+ * @buf: The output.
+ * @len: Number of bytes in @buf.
+ *
+ * Return: Nothing.
+ */
+
+void sendToClient(void *ctx, int fd, const char *buf, size_t len)
+{
+	sendFrame(*(int *)ctx, fd == 1 ? FRAME_STDOUT : FRAME_STDERR, buf, len);
+}
+
+/**
+ * serveClient - Runs the command text sent over one connection.
+ * @conn: The connection.
+ *
+ * The text is read up to the end of the client's input and run in a fresh
+ * session, so nothing carries over from one request to the next. Its
+ * output is streamed back as it is written, followed by its exit status.
+ *
+ * Return: Nothing; the connection is closed.
+ */
+
+void serveClient(int conn)
+{
+	strbuf_t text = {NULL, 0, 0};
+	char buffer[READ_BUFFER_SIZE * 4], status;
+	hsh_session_t *session = NULL;
+	ssize_t bytes;
+
+	while ((bytes = read(conn, buffer, sizeof(buffer))) > 0)
+		appendStrBuf(&text, buffer, bytes);
+	if (!appendStrBuf(&text, "", 0))
+		session = hsh_session_create(sendToClient, &conn);
+	if (session)
+	{
+		status = hsh_session_eval(session, text.buf);
+		hsh_session_destroy(session);
+		sendFrame(conn, FRAME_STATUS, &status, 1);
+	}
+	free(text.buf);
+	close(conn);
+}
+
+/**
+ * runWorker - Serves connections in a pre-forked worker process.
+ * @listenFd: The listening socket, shared by all workers.
+ * @dirFd: The server's working directory, restored after each request.
+ *
+ * Return: Nothing; the worker runs until the server exits.
+ */
+
+void runWorker(int listenFd, int dirFd)
+{
+	int conn, null = open("/dev/null", O_RDONLY);
+
+	prctl(PR_SET_PDEATHSIG, SIGTERM);
+	if (null > STDIN_FILENO)
+		dup2(null, STDIN_FILENO), close(null);
+	while (1)
+	{
+		conn = accept(listenFd, NULL, NULL);
+		if (conn == -1)
+			continue;
+		serveClient(conn);
+		fchdir(dirFd);
+	}
+}
+
+/**
+ * serveShell - Runs the command server ("hsh --serve SOCKET [workers]").
+ * @data: Pointer to the data_t struct containing shell information.
+ * @argv: The socket path, optionally followed by the number of workers
+ * (one per online processor by default).
+ *
+ * The workers are forked up front and all wait in accept() on the same
+ * socket, so a request costs no process start-up. A worker that dies is
+ * replaced.
+ *
+ * Return: 2 on error; otherwise the server runs until it is killed.
+ */
+
+int serveShell(data_t *data, char **argv)
+{
+	int workers = argv[1] ? errStrToInt(argv[1]) : sysconf(_SC_NPROCESSORS_ONLN);
+	int listenFd, dirFd, running = 0;
+	pid_t pid;
+
+	listenFd = (workers > 0) ? openSocket(argv[0], 1) : -1;
+	dirFd = open(".", O_RDONLY | O_CLOEXEC);
+	if (listenFd == -1 || dirFd == -1)
+	{
+		printErrStr(data, data->fName);
+		printErrStr(data, workers > 0 ? ": 0: cannot listen on "
+				: ": 0: Illegal number: ");
+		printErrStr(data, workers > 0 ? argv[0] : argv[1]);
+		printErrChar(data, '\n');
+		printErrChar(data, FLUSH_BUFFER_FLAG);
+		return (2);
+	}
+	while (1)
+	{
+		for (; running < workers; running++)
+		{
+			pid = fork();
+			if (pid == 0)
+				runWorker(listenFd, dirFd);
+			if (pid == -1)
+				break;
+		}
+		if (wait(NULL) != -1)
+			running--;
+		else if (errno != EINTR)
+			sleep(1);
+	}
+}
@@ -0,0 +1,99 @@
+#include "shell.h"
+
+/**
+ * readRequest - Builds the command text a client sends to the server.
+ * @text: Buffer receiving the text.
+ * @argv: Words given after the socket path; when there are none, the
+ * standard input is sent instead.
+ *
+ * Return: 0 on success, or -1 on allocation failure.
+ */
+
+int readRequest(strbuf_t *text, char **argv)
+{
+	char buffer[READ_BUFFER_SIZE * 4];
+	ssize_t bytes;
+	int idx;
+
+	for (idx = 0; argv[idx]; idx++)
+		if ((idx && appendStrBuf(text, " ", 1))
+				|| appendStrBuf(text, argv[idx], strLength(argv[idx])))
+			return (-1);
+	if (idx)
+		return (appendStrBuf(text, "\n", 1) ? -1 : 0);
+	while ((bytes = read(STDIN_FILENO, buffer, sizeof(buffer))) > 0)
+		if (appendStrBuf(text, buffer, bytes))
+			return (-1);
+	return (0);
+}
+
+/**
+ * relayReply - Copies the server's reply frames to the standard output
+ * and error.
+ * @fd: The connection.
+ *
+ * Return: The exit status sent by the server, or -1 if the reply ends
+ * early.
+ */
+
+int relayReply(int fd)
+{
+	unsigned char header[FRAME_HEADER_SIZE];
+	char buffer[READ_BUFFER_SIZE * 4];
+	size_t len, part;
+
+	while (readAll(fd, (char *)header, FRAME_HEADER_SIZE) == 0)
+	{
+		len = ((size_t)header[1] << 24) | (header[2] << 16)
+			| (header[3] << 8) | header[4];
+		if (header[0] == FRAME_STATUS)
+			return (len == 1 && readAll(fd, buffer, 1) == 0
+					? (unsigned char)buffer[0] : -1);
+		for (; len; len -= part)
+		{
+			part = len < sizeof(buffer) ? len : sizeof(buffer);
+			if (readAll(fd, buffer, part) == -1)
+				return (-1);
+			write(header[0] == FRAME_STDOUT ? STDOUT_FILENO : STDERR_FILENO,
+					buffer, part);
+		}
+	}
+	return (-1);
+}
+
+/**
+ * runClient - Runs a command on a command server
+ * ("hsh --client SOCKET [command...]").
+ * @data: Pointer to the data_t struct containing shell information.
+ * @argv: The socket path, followed by the command's words, if any.
+ *
+ * Return: The command's exit status, or 2 on error.
+ */
+
+int runClient(data_t *data, char **argv)
+{
+	strbuf_t text = {NULL, 0, 0};
+	int fd, status = -1;
+
+	fd = openSocket(argv[0], 0);
+	if (fd != -1 && readRequest(&text, argv + 1) == 0
+			&& sendAll(fd, text.buf, text.len) == 0)
+	{
+		shutdown(fd, SHUT_WR);
+		status = relayReply(fd);
+	}
+	free(text.buf);
+	if (fd != -1)
+		close(fd);
+	if (status == -1)
+	{
+		printErrStr(data, data->fName);
+		printErrStr(data, fd == -1 ? ": 0: cannot connect to "
+				: ": 0: lost connection to ");
+		printErrStr(data, argv[0]);
+		printErrChar(data, '\n');
+		printErrChar(data, FLUSH_BUFFER_FLAG);
+		return (2);
+	}
+	return (status);
+}
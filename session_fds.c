@@ -0,0 +1,147 @@
+#include "shell.h"
+
+/**
+ * sessionFd - Finds the descriptor a library session's descriptor refers to.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @fd: The session's descriptor.
+ *
+ * Return: The process's descriptor, or -1 if @fd is closed or goes to the
+ * sink's function.
+ */
+
+int sessionFd(data_t *data, int fd)
+{
+	if (!data->fdMap)
+		return (fd);
+	fd = (fd >= 0 && fd < SESSION_FDS) ? data->fdMap[fd] : -1;
+	return (fd < 0 ? -1 : fd);
+}
+
+/**
+ * dupSessionFd - Copies a descriptor for an N>&M or N<&M redirection.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @fd: The descriptor to copy (M).
+ *
+ * In a library session the copy of a descriptor going to the sink is the
+ * sink itself.
+ *
+ * Return: The copy, FD_SINK_OUT or FD_SINK_ERR, or -1 on error.
+ */
+
+int dupSessionFd(data_t *data, int fd)
+{
+	if (!data->fdMap)
+		return (fcntl(fd, F_DUPFD_CLOEXEC, 10));
+	fd = (fd >= 0 && fd < SESSION_FDS) ? data->fdMap[fd] : -1;
+	if (fd == FD_SINK_OUT || fd == FD_SINK_ERR || fd == -1)
+		return (fd);
+	return (fcntl(fd, F_DUPFD_CLOEXEC, SESSION_FDS));
+}
+
+/**
+ * mapRedirs - Applies a command's redirections in a library session.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @redir: The first redirection.
+ * @saved: Room for two ints per redirection, filled with each redirected
+ * descriptor and what it referred to before.
+ *
+ * Only the session's descriptor map changes; the process's own
+ * descriptors, which the host program and other sessions share, are left
+ * alone.
+ *
+ * Return: Number of redirections applied, or -1 on error.
+ */
+
+int mapRedirs(data_t *data, redir_t *redir, int *saved)
+{
+	int count, fd;
+
+	for (count = 0; redir; redir = redir->next, count++)
+	{
+		if (redir->fd >= SESSION_FDS)
+		{
+			printShellErr(data, "Bad fd number: ");
+			printErrStr(data, convertNum(data, redir->fd, 10, 0));
+			printErrChar(data, '\n');
+			fd = -1;
+		}
+		else
+			fd = openRedir(data, redir);
+		if (fd == -1)
+		{
+			unmapRedirs(data, saved, count);
+			return (-1);
+		}
+		saved[2 * count] = redir->fd;
+		saved[2 * count + 1] = data->fdMap[redir->fd];
+		data->fdMap[redir->fd] = (fd == REDIR_CLOSE) ? -1 : fd;
+		data->stdinRedirs += (redir->fd == STDIN_FILENO);
+	}
+	return (count);
+}
+
+/**
+ * unmapRedirs - Undoes redirections made by mapRedirs(), the last one
+ * first.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @saved: The descriptors saved by mapRedirs().
+ * @count: Number of redirections to undo.
+ *
+ * Return: Nothing.
+ */
+
+void unmapRedirs(data_t *data, int *saved, int count)
+{
+	int fd;
+
+	while (count--)
+	{
+		fd = saved[2 * count];
+		if (data->fdMap[fd] >= 0)
+			close(data->fdMap[fd]);
+		data->fdMap[fd] = saved[2 * count + 1];
+		data->stdinRedirs -= (fd == STDIN_FILENO);
+	}
+}
+
+/**
+ * placeSessionFds - Gives a new child process of a library session the
+ * descriptors the session's map describes.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @stdio: Descriptors to use as the child's 0, 1 and 2 instead (-1 to keep
+ * the session's), closed once placed; or NULL.
+ *
+ * Descriptors going to the sink become its pipes. Every descriptor is
+ * first copied above the session's range, so none is overwritten before
+ * it has been placed.
+ *
+ * Return: Nothing.
+ */
+
+void placeSessionFds(data_t *data, int *stdio)
+{
+	int fd, target, moved[SESSION_FDS];
+
+	for (target = 0; target < SESSION_FDS; target++)
+	{
+		fd = (stdio && target < 3 && stdio[target] != -1) ? stdio[target]
+			: data->fdMap[target];
+		if (fd == FD_SINK_OUT || fd == FD_SINK_ERR)
+			fd = data->sink->writeFds[fd == FD_SINK_ERR];
+		moved[target] = (fd >= 0) ? fcntl(fd, F_DUPFD_CLOEXEC, SESSION_FDS)
+			: -1;
+	}
+	for (target = 0; stdio && target < 3; target++)
+		if (stdio[target] != -1)
+			close(stdio[target]);
+	for (target = 0; target < SESSION_FDS; target++)
+	{
+		if (moved[target] == -1)
+			close(target);
+		else
+		{
+			dup2(moved[target], target);
+			close(moved[target]);
+		}
+	}
+}
@@ -0,0 +1,32 @@
+#include "shell.h"
+
+/**
+ * setCmd - Implements the set built-in ("set [-x | +x]...").
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * -x turns the execution trace on and +x turns it off. Without arguments
+ * the shell variables are listed.
+ *
+ * Return: 0 on success, or 2 on an unknown option.
+ */
+
+int setCmd(data_t *data)
+{
+	int idx;
+
+	if (!data->argv[1])
+		return (displayEnv(data));
+	for (idx = 1; data->argv[idx]; idx++)
+	{
+		if ((data->argv[idx][0] != '-' && data->argv[idx][0] != '+')
+				|| cmpStr(data->argv[idx] + 1, "x"))
+		{
+			printShellErr(data, "Illegal option ");
+			printErrStr(data, data->argv[idx]);
+			printErrChar(data, '\n');
+			return (2);
+		}
+		startTrace(data, data->argv[idx][0] == '-');
+	}
+	return (0);
+}
@@ -11,6 +11,16 @@
 #include <unistd.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <dirent.h>
+#include <sys/syscall.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/prctl.h>
+#include <linux/sched.h>
+#include <sys/resource.h>
+#include <time.h>
+#include "hsh.h"
 
 #define CONVERT_TO_LOWERCASE 1
 #define CONVERT_TO_UNSIGNED 2
@@ -20,16 +30,179 @@
 
 #define READ_BUFFER_SIZE 1024
 #define WRITE_BUFFER_SIZE 1024
+#define NUM_BUFFER_SIZE 50
+#define PATH_BUFFER_SIZE 4096
 #define FLUSH_BUFFER_FLAG -1
 
-#define NORMAL_COMMAND 0
-#define OR_COMMAND 1
-#define AND_COMMAND 2
-#define CHAIN_COMMAND 3
+#define FRAME_HEADER_SIZE 5
+#define FRAME_STDOUT 'o'
+#define FRAME_STDERR 'e'
+#define FRAME_STATUS 'x'
+
+#define ZYGOTE_MAX_FDS 10
+#define ZYGOTE_MAX_REQUEST (256 * 1024)
+
+#define NODE_CMD 0
+#define NODE_LIST 1
+#define NODE_AND 2
+#define NODE_OR 3
+#define NODE_NOT 4
+#define NODE_GROUP 5
+#define NODE_IF 6
+#define NODE_WHILE 7
+#define NODE_UNTIL 8
+#define NODE_FOR 9
+#define NODE_CASE 10
+#define NODE_CASE_ITEM 11
+#define NODE_FUNC 12
+#define NODE_PIPE 13
+#define NODE_SUBSHELL 14
+#define NODE_CONCURRENT 15
+#define NODE_STEP 16
+#define NODE_TIME 17
+
+#define TOK_WORD 1
+#define TOK_NEWLINE 2
+#define TOK_SEMI 3
+#define TOK_DSEMI 4
+#define TOK_AND 5
+#define TOK_OR 6
+#define TOK_PIPE 7
+#define TOK_AMP 8
+#define TOK_LPAREN 9
+#define TOK_RPAREN 10
+#define TOK_EOF 11
+#define TOK_REDIR 12
+
+#define REDIR_IN 1
+#define REDIR_OUT 2
+#define REDIR_APPEND 3
+#define REDIR_DUP_IN 4
+#define REDIR_DUP_OUT 5
+#define REDIR_HEREDOC 6
+#define REDIR_HEREDOC_TABS 7
+#define REDIR_HERESTR 8
+#define REDIR_CLOSE -2
+
+/* Descriptors of a library session; the last two refer to its sink */
+#define SESSION_FDS 10
+#define FD_SINK_OUT -3
+#define FD_SINK_ERR -4
+
+#define PARSE_OK 0
+#define PARSE_INCOMPLETE 1
+#define PARSE_ERROR 2
+
+/* How far the executor unwinds after break, continue, return or exit */
+#define UNWIND_BREAK 1
+#define UNWIND_CONTINUE 2
+#define UNWIND_RETURN 3
+#define UNWIND_EXIT 4
+#define UNWIND_ERROR 5
+
+#define ARENA_BLOCK_SIZE 4096
+
+/* Here-documents up to this size go through a pipe instead of a memfd */
+#define HEREDOC_PIPE_MAX 4096
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 1
+#endif
+
+#define CMD_NOT_FOUND 0
+#define CMD_ALIAS 1
+#define CMD_BUILTIN 2
+#define CMD_FUNCTION 3
+#define CMD_FILE 4
+
+#define CMD_CACHE_SIZE 64
+
+/* The builtin never changes shell state, so it may run in-process anywhere */
+#define BUILTIN_PURE 1
+/* The builtin only changes state a subshell snapshot restores */
+#define BUILTIN_SUBSHELL 2
+
+/* What a subshell snapshot saves on its first change */
+#define SNAP_ENV 1
+#define SNAP_ALIAS 2
+#define SNAP_CWD 3
+
+/* How far a step of a concurrent block has got */
+#define STEP_PENDING 0
+#define STEP_READY 1
+#define STEP_RUNNING 2
+#define STEP_DONE 3
+#define STEP_FAILED 4
+#define STEP_SKIPPED 5
+
+#define ARITH_CACHE_SIZE 64
+#define ARITH_NAME_MAX 256
+
+#define ARITH_NUM 0
+#define ARITH_VAR 1
+#define ARITH_UNARY 2
+#define ARITH_BINARY 3
+#define ARITH_TERNARY 4
+#define ARITH_ASSIGN 5
+#define ARITH_PREFIX 6
+#define ARITH_POSTFIX 7
+#define ARITH_PARAM 8
+
+#define ARITH_TOK_NUM 1
+#define ARITH_TOK_NAME 2
+#define ARITH_TOK_END 3
+#define ARITH_TOK_ERR 4
+#define ARITH_TOK_PARAM 5
+
+/* Packs an operator of up to three characters into one int (e.g. "<<=") */
+#define AOP(a, b, c) ((a) | ((b) << 8) | ((c) << 16))
+
+/* Marks blanks produced by command substitution for word splitting */
+#define FIELD_SEPARATOR '\001'
+/* Separates the parameters of "$@", which stay fields even when empty */
+#define FIELD_BREAK '\002'
 
 #define USE_SYSTEM_STRTOK 0
 #define USE_SYSTEM_GETLINE 0
 
+/* Seeded FNV-1a, shared by hashBuiltinName() and tools/gen_builtin_hash.c */
+#define BUILTIN_HASH_STEP(hash, c) (((hash) ^ (c)) * 16777619U)
+#define BUILTIN_HASH_FINAL(hash) ((hash) ^ ((hash) >> 16))
+
+/* Phases of the shell's work timed by the stats built-in */
+#define PHASE_READ 0
+#define PHASE_PARSE 1
+#define PHASE_EXPAND 2
+#define PHASE_RESOLVE 3
+#define PHASE_SPAWN 4
+#define PHASE_WAIT 5
+#define NUM_PHASES 6
+#define PHASE_NAMES {"read", "parse", "expand", "resolve", "spawn", "wait"}
+#define STATS_BUCKETS 24
+
+/* Counters kept by the stats built-in; each cache has a hit and a miss */
+#define STAT_ALLOCS 0
+#define STAT_SYSCALLS 1
+#define STAT_CMD_HITS 2
+#define STAT_CMD_MISSES 3
+#define STAT_ARITH_HITS 4
+#define STAT_ARITH_MISSES 5
+#define STAT_GLOB_HITS 6
+#define STAT_GLOB_MISSES 7
+#define STAT_SOURCE_HITS 8
+#define STAT_SOURCE_MISSES 9
+#define STAT_COMMANDS 10
+#define STAT_BUILTIN_TIME 11
+#define STAT_EXTERNAL_TIME 12
+#define NUM_COUNTERS 13
+
+/* Probes for the stats built-in; a single test while statistics are off */
+/* A run begun while they were off (start 0) is not recorded */
+#define STATS_BEGIN(data) ((data)->stats ? nowNanos() : 0)
+#define STATS_END(data, phase, start) ((data)->stats && (start) ? \
+		addPhaseTime((data)->stats, (phase), (start)) : (void)0)
+#define STATS_ADD(data, counter, n) ((data)->stats ? \
+		(void)((data)->stats->counters[(counter)] += (n)) : (void)0)
+
 /**
  * struct item_t - Represents an element in a singly linked list of strings.
  * @number: Numeric identifier for the item.
@@ -47,30 +220,224 @@ typedef struct item_t
 	struct item_t *next;
 } item_t;
 
+/**
+ * struct strbuf_t - A growable, NUL-terminated byte buffer.
+ * @buf: The buffer, or NULL until something is appended.
+ * @len: Number of bytes in use (excluding the terminating NUL).
+ * @size: Number of bytes allocated.
+ */
+typedef struct strbuf_t
+{
+	char *buf;
+	size_t len;
+	size_t size;
+} strbuf_t;
+
+/**
+ * struct inbuf_t - Buffered input of the shell.
+ * @buf: Bytes read from the input (one extra byte keeps it terminated).
+ * @pos: Index of the first byte not consumed yet.
+ * @len: Number of bytes in @buf.
+ */
+typedef struct inbuf_t
+{
+	char buf[READ_BUFFER_SIZE + 1];
+	size_t pos;
+	size_t len;
+} inbuf_t;
+
+/**
+ * struct outbuf_t - Buffered output to one descriptor.
+ * @buf: Characters not written yet.
+ * @len: Number of characters in @buf.
+ */
+typedef struct outbuf_t
+{
+	char buf[WRITE_BUFFER_SIZE];
+	int len;
+} outbuf_t;
+
+/**
+ * struct sink_t - Where a library session's output goes.
+ * @write: The caller's function receiving the output.
+ * @ctx: The caller's context pointer.
+ * @readFds: Read ends of the pipes child processes write their standard
+ * output and error to.
+ * @writeFds: Write ends of those pipes.
+ */
+typedef struct sink_t
+{
+	hsh_sink_fn write;
+	void *ctx;
+	int readFds[2];
+	int writeFds[2];
+} sink_t;
+
+/**
+ * struct usage_t - Resources used by a command or its child processes.
+ * @real: Elapsed time in microseconds, or a start time.
+ * @user: User CPU time in microseconds.
+ * @sys: System CPU time in microseconds.
+ * @maxRss: Largest resident set size in kilobytes.
+ * @csw: Number of context switches, voluntary and involuntary.
+ */
+typedef struct usage_t
+{
+	long real;
+	long user;
+	long sys;
+	long maxRss;
+	long csw;
+} usage_t;
+
+/**
+ * struct phase_stat_t - How often a phase of the shell's work ran and how
+ * long it took.
+ * @count: Number of runs.
+ * @total: Total time in nanoseconds.
+ * @max: Longest run in nanoseconds.
+ * @buckets: Latency histogram; bucket N counts runs under 2^N microseconds.
+ */
+typedef struct phase_stat_t
+{
+	long count;
+	long total;
+	long max;
+	long buckets[STATS_BUCKETS];
+} phase_stat_t;
+
+/**
+ * struct stats_t - Statistics printed by the stats built-in.
+ * @phases: One entry per PHASE_* value.
+ * @counters: One entry per STAT_* value; times are in nanoseconds.
+ * @failures: Number of commands that failed, by exit status.
+ */
+typedef struct stats_t
+{
+	phase_stat_t phases[NUM_PHASES];
+	long counters[NUM_COUNTERS];
+	long failures[256];
+} stats_t;
+
+/**
+ * struct trace_t - The execution trace turned on by "set -x".
+ * @fd: The shell's own copy of the descriptor the trace goes to, FD_SINK_OUT
+ * or FD_SINK_ERR for a library session's sink, or -1 while tracing is off.
+ * @out: Trace lines not written yet, kept apart from the standard error.
+ */
+typedef struct trace_t
+{
+	int fd;
+	outbuf_t out;
+} trace_t;
+
+/**
+ * struct metrics_t - Where and how often the statistics are published for
+ * a Prometheus textfile collector.
+ * @path: The metrics file, or NULL to publish nothing.
+ * @interval: Nanoseconds between writes while the shell runs, or 0 to
+ * write only at exit.
+ * @due: When the next write is due, from nowNanos().
+ * @owner: The shell process; its forked children never write the file.
+ */
+typedef struct metrics_t
+{
+	char *path;
+	long interval;
+	long due;
+	pid_t owner;
+} metrics_t;
+
+/**
+ * struct zygote_t - Connection to the zygote that launches external
+ * commands from pre-forked children.
+ * @fd: The shell's end of the request socket, or -1 without a zygote.
+ * @owner: The process that started the zygote; its forked children do not
+ * use it.
+ */
+typedef struct zygote_t
+{
+	int fd;
+	pid_t owner;
+} zygote_t;
+
 /**
  * struct data_t - Structure for holding various command-related information.
- * @arg: Command arguments as a string.
  * @argc: Number of command arguments.
  * @argv: Array of command argument strings.
  * @commandPath: Path to the current command.
  * @execStat: Status code from the last executed command.
- * @cmdBuf: Pointer to a command buffer for chaining commands.
- * @cmdBufType: Type of command separator (e.g., ||, &&, or ;).
  * @readDescriptor: File descriptor for reading input.
  * @historyCounter: Counter for command history line numbers.
  * @lineCounter: Current line number.
  * @fName: Name of the program file.
  * @errorCode: Error code for exit() calls.
- * @lineCounterFlag: Flag to indicate line counting.
  * @envList: Linked list for storing environment variables.
  * @historyList: Linked list for storing command history.
  * @aliasList: Linked list for storing aliases.
  * @environ: Array of custom-modified environment variables.
  * @envChanged: Flag indicating if the environment was altered.
+ * @cmdCache: Cache of resolved command names (CMD_CACHE_SIZE slots).
+ * @cmdCacheCount: Number of occupied slots in @cmdCache.
+ * @varIndex: Hash index from variable names to @envList nodes.
+ * @varIndexSize: Number of slots in @varIndex (a power of two).
+ * @varIndexValid: False when @varIndex must be rebuilt before use.
+ * @exp: Reusable buffer that words are expanded into; a backslash in it
+ * makes the next character literal in patterns.
+ * @expSplit: Set when @exp holds field separators to split at.
+ * @expQuoted: Bit 1 is set once the word being expanded had quoting, bit 2
+ * while the text being expanded is quoted.
+ * @arithCache: Compiled arithmetic expressions, keyed by their source text.
+ * @arithCacheCount: Number of occupied slots in @arithCache.
+ * @globCache: Directory listings read while globbing the current line.
+ * @inputLine: Number of input lines read so far.
+ * @loopDepth: Number of loops the executor is currently inside.
+ * @unwind: Set (to an UNWIND_* value) while break, continue or exit unwind
+ * the commands being run, or after an expansion error.
+ * @unwindCount: Number of loops left to unwind for break and continue.
+ * @funcList: The defined shell functions.
+ * @program: The program whose tree is being run, which function
+ * definitions keep alive.
+ * @posArgs: The positional parameters ($1 onwards); not owned.
+ * @posCount: Number of positional parameters.
+ * @posJoin: Buffer holding $@ or $* joined with spaces for operators such
+ * as ${@:-word}.
+ * @localVars: Saved values of variables made local, most recent first;
+ * each item's number is the function depth it belongs to, and a string
+ * without '=' marks a variable that was not set.
+ * @funcDepth: Number of function calls currently running.
+ * @sourceCache: Programs parsed from sourced files, by file identity.
+ * @sourceDepth: Number of sourced files currently running.
+ * @input: Input read from @readDescriptor but not consumed yet, shared by
+ * the command reader and the read built-in.
+ * @stdinRedirs: Number of redirections of standard input in effect.
+ * @snapshot: The innermost subshell running in-process, if any.
+ * @out: Buffered standard output.
+ * @err: Buffered standard error.
+ * @fileOut: Buffered output to other descriptors, such as the history file.
+ * @capture: Buffer standard output is collected in instead of being
+ * written, or NULL.
+ * @numBuf: Holds the string convertNum() returns.
+ * @pathBuf: Holds the path findCmdInPath() returns.
+ * @sink: The output sink of a library session, or NULL to write to the
+ * standard output and error.
+ * @zygote: The zygote used to launch external commands, if any.
+ * @tailCmd: The last simple command of a command string, which may
+ * replace the shell when it runs an external program.
+ * @execTail: True while that command is being run.
+ * @children: Resources used by the child processes reaped so far.
+ * @lastUsage: Resources used by the last command, for the HSH_* variables.
+ * @stats: Statistics on the shell's own work, or NULL while they are off.
+ * @metrics: The metrics file the statistics are published to.
+ * @trace: The execution trace.
+ * @fdMap: In a library session, what each of its descriptors 0 to 9 refers
+ * to: a descriptor of the process, FD_SINK_OUT, FD_SINK_ERR or -1 if
+ * closed. Redirections change the map instead of the process's own
+ * descriptors. NULL in the shell itself.
+ * @shellPid: The process ID of the shell, recorded at startup, for $$.
  */
 typedef struct data_t
 {
-	char *arg;
 	char **argv;
 	char *commandPath;
 	int argc;
@@ -78,16 +445,57 @@ typedef struct data_t
 	int readDescriptor;
 	int historyCounter;
 	unsigned int lineCounter;
-	int cmdBufType;
 	int errorCode;
-	int lineCounterFlag;
 	char *fName;
-	char **cmdBuf;
 	item_t *envList;
 	item_t *historyList;
 	item_t *aliasList;
 	char **environ;
 	int envChanged;
+	struct cmd_cache_t *cmdCache;
+	int cmdCacheCount;
+	struct item_t **varIndex;
+	size_t varIndexSize;
+	int varIndexValid;
+	strbuf_t exp;
+	int expSplit;
+	int expQuoted;
+	struct arith_expr_t **arithCache;
+	int arithCacheCount;
+	struct glob_dir_t *globCache;
+	int inputLine;
+	int loopDepth;
+	int unwind;
+	int unwindCount;
+	struct func_t *funcList;
+	struct program_t *program;
+	char **posArgs;
+	int posCount;
+	strbuf_t posJoin;
+	item_t *localVars;
+	int funcDepth;
+	struct source_t *sourceCache;
+	int sourceDepth;
+	inbuf_t input;
+	int stdinRedirs;
+	struct snapshot_t *snapshot;
+	outbuf_t out;
+	outbuf_t err;
+	outbuf_t fileOut;
+	strbuf_t *capture;
+	char numBuf[NUM_BUFFER_SIZE];
+	char pathBuf[PATH_BUFFER_SIZE];
+	sink_t *sink;
+	zygote_t zygote;
+	struct node_t *tailCmd;
+	int execTail;
+	usage_t children;
+	usage_t lastUsage;
+	stats_t *stats;
+	metrics_t metrics;
+	trace_t trace;
+	int *fdMap;
+	pid_t shellPid;
 } data_t;
 
 /**
@@ -95,6 +503,7 @@ typedef struct data_t
  * action.
  * @command: The name of the built-in command.
  * @function: A function pointer pointing to the command's execution function.
+ * @flags: BUILTIN_* properties of the command.
  *
  * This structure associates a built-in command's name with its respective
  * handling function.
@@ -103,13 +512,422 @@ typedef struct BuiltinCommand
 {
 	char *command;
 	int (*function)(data_t *);
+	int flags;
 } BuiltinCommand;
 
+/**
+ * struct resolved_t - The tagged result of resolving a command name.
+ * @type: What the name resolved to (one of the CMD_* values).
+ * @value: The alias value, for CMD_ALIAS.
+ * @builtin: The builtin table entry, for CMD_BUILTIN or a function hiding a
+ * builtin.
+ * @path: The full path of the executable, for CMD_FILE or a function hiding
+ * an executable.
+ * @func: The function, for CMD_FUNCTION.
+ */
+typedef struct resolved_t
+{
+	int type;
+	char *value;
+	const BuiltinCommand *builtin;
+	char *path;
+	struct func_t *func;
+} resolved_t;
+
+/**
+ * struct cmd_cache_t - One entry of the command resolution cache.
+ * @name: The command name, or NULL if the slot is free.
+ * @aliasValue: The alias value if @name is an alias, otherwise NULL.
+ * @type: What @name resolves to when aliases are ignored.
+ * @builtin: The builtin table entry, if @name is a builtin.
+ * @path: The full path of the executable, if @name is not a builtin but is
+ * found in PATH.
+ * @func: The function, for CMD_FUNCTION; @builtin and @path still tell
+ * what the function hides.
+ */
+typedef struct cmd_cache_t
+{
+	char *name;
+	char *aliasValue;
+	int type;
+	const BuiltinCommand *builtin;
+	char *path;
+	struct func_t *func;
+} cmd_cache_t;
+
+/**
+ * struct arith_node_t - One node of a compiled arithmetic expression.
+ * @kind: The node kind (one of the ARITH_* values).
+ * @op: The operator code (see AOP); for assignments, the operator applied.
+ * @value: The constant, for ARITH_NUM, or the parameter's value, for
+ * ARITH_PARAM.
+ * @name: The variable name (not NUL-terminated), for variable and
+ * parameter nodes.
+ * @nameLen: Length of @name.
+ * @left: Index of the first operand (or ?: true branch), or -1.
+ * @right: Index of the second operand (or ?: false branch), or -1.
+ * @cond: Index of the ?: condition, or -1.
+ */
+typedef struct arith_node_t
+{
+	int kind;
+	int op;
+	long value;
+	char *name;
+	int nameLen;
+	int left;
+	int right;
+	int cond;
+} arith_node_t;
+
+/**
+ * struct arith_expr_t - A compiled arithmetic expression.
+ * @text: The expression source, which variable names point into.
+ * @nodes: The node array.
+ * @count: Number of nodes in use.
+ * @size: Number of nodes allocated.
+ * @root: Index of the root node, or -1 after a syntax error.
+ * @params: Number of $name references (ARITH_PARAM nodes).
+ */
+typedef struct arith_expr_t
+{
+	char *text;
+	arith_node_t *nodes;
+	int count;
+	int size;
+	int root;
+	int params;
+} arith_expr_t;
+
+/**
+ * struct arith_parser_t - State of the arithmetic expression parser.
+ * @expr: The expression being compiled.
+ * @pos: Current position in the source.
+ * @tok: The current token (an AOP code or one of the ARITH_TOK_* values).
+ * @tokPos: Start of the current token.
+ * @tokLen: Length of the current token.
+ * @tokValue: Value of the current token, for ARITH_TOK_NUM.
+ * @error: Set once a syntax error is found.
+ */
+typedef struct arith_parser_t
+{
+	arith_expr_t *expr;
+	char *pos;
+	int tok;
+	char *tokPos;
+	int tokLen;
+	long tokValue;
+	int error;
+} arith_parser_t;
+
+/**
+ * struct cmd_state_t - Per-command state saved while another command line
+ * runs in-process (for example inside a command substitution).
+ * @argv: The saved argument vector.
+ * @argc: The saved argument count.
+ * @commandPath: The saved command path.
+ * @lineCounter: The saved line number.
+ * @exp: The saved expansion buffer.
+ * @expSplit: The saved field splitting flag.
+ * @expQuoted: The saved quoting flags.
+ */
+typedef struct cmd_state_t
+{
+	char **argv;
+	int argc;
+	char *commandPath;
+	unsigned int lineCounter;
+	strbuf_t exp;
+	int expSplit;
+	int expQuoted;
+} cmd_state_t;
+
+/**
+ * struct redir_t - One redirection of a command.
+ * @type: The kind of redirection (one of the REDIR_* values).
+ * @fd: The file descriptor being redirected.
+ * @word: The target word, or the body of a here-document once it is read.
+ * @expand: True if a here-document body must be expanded when it is used.
+ * @next: The command's next redirection.
+ * @nextDoc: The next here-document whose body is still to be read.
+ */
+typedef struct redir_t
+{
+	int type;
+	int fd;
+	char *word;
+	int expand;
+	struct redir_t *next;
+	struct redir_t *nextDoc;
+} redir_t;
+
+/**
+ * struct node_t - One node of a parsed command tree.
+ * @type: The node type (one of the NODE_* values).
+ * @line: The input line the node starts on.
+ * @count: Number of strings in @words, or the job limit of a concurrent
+ * block (0 for one job per online processor).
+ * @words: The raw words of a simple command, the word list of a for loop
+ * (NULL when it has no "in" part), the patterns of a case item, or the
+ * names of the steps a concurrent step runs after.
+ * @name: The variable of a for loop, the word a case statement tests, the
+ * name of a function or of a concurrent step.
+ * @left: The first child: a list's or and-or's left side, a condition, the
+ * body of a group, of "!", of a function or of a concurrent step, or the
+ * first item of a case statement or of a concurrent block.
+ * @right: The second child: a list's or and-or's right side, or the body of
+ * an if, a loop or a case item.
+ * @next: The else part of an if, or the next item of a case statement or
+ * step of a concurrent block.
+ * @redirs: The redirections applied while the command runs.
+ */
+typedef struct node_t
+{
+	int type;
+	int line;
+	int count;
+	char **words;
+	char *name;
+	struct node_t *left;
+	struct node_t *right;
+	struct node_t *next;
+	redir_t *redirs;
+} node_t;
+
+/**
+ * struct arena_block_t - Header of one block of a program's arena.
+ * @next: The previously filled block.
+ * @used: Number of bytes handed out from this block.
+ * @size: Number of bytes available after the header.
+ */
+typedef struct arena_block_t
+{
+	struct arena_block_t *next;
+	size_t used;
+	size_t size;
+} arena_block_t;
+
+/**
+ * struct program_t - A parsed command tree and the arena that holds it.
+ * @arena: The most recent arena block; every node and word lives in it.
+ * @root: The root of the tree, or NULL for an empty program.
+ * @refs: Number of holders; the program is freed when it drops to zero.
+ */
+typedef struct program_t
+{
+	arena_block_t *arena;
+	node_t *root;
+	int refs;
+} program_t;
+
+/**
+ * struct func_t - A shell function.
+ * @name: The function name.
+ * @body: The parsed body, inside @prog.
+ * @prog: The program the function was defined in, held while the function
+ * exists so its body is never parsed again.
+ * @next: The next function.
+ */
+typedef struct func_t
+{
+	char *name;
+	node_t *body;
+	program_t *prog;
+	struct func_t *next;
+} func_t;
+
+/**
+ * struct source_t - A sourced file's parsed program.
+ * @dev: Device of the file.
+ * @ino: Inode of the file.
+ * @mtime: Modification time of the file when it was parsed.
+ * @mtimeNsec: Nanoseconds part of @mtime.
+ * @size: Size of the file when it was parsed.
+ * @prog: The parsed program (held by the cache).
+ * @next: The next cached file.
+ */
+typedef struct source_t
+{
+	dev_t dev;
+	ino_t ino;
+	time_t mtime;
+	long mtimeNsec;
+	off_t size;
+	program_t *prog;
+	struct source_t *next;
+} source_t;
+
+/**
+ * struct snapshot_t - Shell state of a subshell run in-process.
+ * @env: Copy of the variables, taken before the subshell first changes
+ * them.
+ * @aliases: Copy of the aliases, taken before the first change.
+ * @envSaved: Set once @env holds the copy.
+ * @aliasSaved: Set once @aliases holds the copy.
+ * @cwdFd: Descriptor of the working directory before the first cd, or -1.
+ * @posArgs: The positional parameters.
+ * @posCount: Number of positional parameters.
+ * @loopDepth: Number of loops around the subshell.
+ * @errorCode: The exit code pending around the subshell.
+ * @outer: The snapshot of the subshell this one runs in, if any.
+ */
+typedef struct snapshot_t
+{
+	item_t *env;
+	item_t *aliases;
+	int envSaved;
+	int aliasSaved;
+	int cwdFd;
+	char **posArgs;
+	int posCount;
+	int loopDepth;
+	int errorCode;
+	struct snapshot_t *outer;
+} snapshot_t;
+
+/**
+ * struct pipe_state_t - State carried between the stages of a pipeline.
+ * @inFd: Read end of the previous stage's output, or -1.
+ * @out: Output of the previous stage when it ran in-process.
+ * @buffered: Set when @out holds the previous stage's output.
+ */
+typedef struct pipe_state_t
+{
+	int inFd;
+	strbuf_t out;
+	int buffered;
+} pipe_state_t;
+
+/**
+ * struct par_job_t - One running job of the parallel built-in or of a
+ * concurrent block.
+ * @pid: The job's process ID, or 0 if the slot is free.
+ * @fds: Read ends of the job's standard output and error (-1 once closed).
+ * @out: The job's standard output so far.
+ * @err: The job's standard error so far.
+ * @tag: What the job runs, for its owner (the step of a concurrent block).
+ * @status: The job's exit status once it has finished.
+ * @start: When the job started, from nowNanos(), or 0 if statistics were
+ * off.
+ */
+typedef struct par_job_t
+{
+	pid_t pid;
+	int fds[2];
+	strbuf_t out;
+	strbuf_t err;
+	int tag;
+	int status;
+	long start;
+} par_job_t;
+
+/**
+ * struct step_t - One step of a concurrent block while it runs.
+ * @node: The NODE_STEP.
+ * @state: One of the STEP_* values.
+ * @first: Index of the step's first dependency in the block's dependency
+ * array; the step has @node->count of them.
+ */
+typedef struct step_t
+{
+	node_t *node;
+	int state;
+	int first;
+} step_t;
+
+/**
+ * struct read_state_t - A record being read by the read built-in.
+ * @out: The characters read so far, with escapes removed.
+ * @delim: The character ending the record.
+ * @max: Number of characters to stop after, or -1 for no limit.
+ * @count: Number of characters read so far.
+ * @raw: True (-r) if backslashes are ordinary characters.
+ * @escaped: True right after an unquoted backslash.
+ * @found: Set once @delim was read.
+ */
+typedef struct read_state_t
+{
+	strbuf_t out;
+	char delim;
+	int max;
+	int count;
+	int raw;
+	int escaped;
+	int found;
+} read_state_t;
+
+/**
+ * struct parser_t - State of the command parser.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @prog: The program being built.
+ * @text: The source text.
+ * @pos: Current position in @text.
+ * @line: Line number at @pos.
+ * @tok: The current token (one of the TOK_* values).
+ * @word: The current word, for TOK_WORD (allocated in the arena).
+ * @tokPos: Start of the current token in @text.
+ * @status: PARSE_OK, or why parsing stopped.
+ * @redirType: The kind of redirection, for TOK_REDIR.
+ * @redirFd: The file descriptor redirected, for TOK_REDIR.
+ * @docs: Here-documents whose bodies start after the next newline.
+ */
+typedef struct parser_t
+{
+	data_t *data;
+	program_t *prog;
+	char *text;
+	int pos;
+	int line;
+	int tok;
+	char *word;
+	int tokPos;
+	int status;
+	int redirType;
+	int redirFd;
+	redir_t *docs;
+} parser_t;
+
+/**
+ * struct glob_dir_t - A cached, sorted directory listing.
+ * @path: The directory that was read.
+ * @names: Its entries in sorted order, without "." and "..".
+ * @count: Number of entries in @names.
+ * @next: The next cached listing.
+ */
+typedef struct glob_dir_t
+{
+	char *path;
+	char **names;
+	int count;
+	struct glob_dir_t *next;
+} glob_dir_t;
+
+/**
+ * struct glob_state_t - A pathname expansion in progress.
+ * @data: Pointer to the data_t struct holding the listing cache.
+ * @args: Pointer to the vector receiving the matches.
+ * @count: Pointer to the number of strings in @args.
+ * @size: Pointer to the number of slots allocated for @args.
+ * @matched: Number of paths added so far.
+ */
+typedef struct glob_state_t
+{
+	data_t *data;
+	char ***args;
+	int *count;
+	int *size;
+	int matched;
+} glob_state_t;
+
 /* Initializes a struct data_t with default values. */
 #define INIT_SHELL_INFO															\
 	{																			\
-		NULL, NULL, NULL, 0, 0, 0, 0, 0, 0, 0, 0, NULL, NULL, NULL, NULL, NULL,	\
-			NULL, 0																\
+		NULL, NULL, 0, 0, 0, 0, 0, 0, NULL, NULL, NULL, NULL, NULL, 0, NULL,	\
+			0, NULL, 0, 0, {NULL, 0, 0}, 0, 0, NULL, 0, NULL, 0, 0, 0, 0,		\
+			NULL, NULL, NULL, 0, {NULL, 0, 0}, NULL, 0, NULL, 0, {{0}, 0, 0}, 0,	\
+			NULL, {{0}, 0}, {{0}, 0}, {{0}, 0}, NULL, {0}, {0}, NULL, {-1, 0},	\
+			NULL, 0, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, NULL, {NULL, 0, 0, 0},	\
+			{-1, {{0}, 0}}, NULL, 0												\
 	}
 
 extern char **environ;
@@ -117,14 +935,14 @@ extern char **environ;
 /* Linked list handler functions */
 size_t getListLen(const item_t *);
 char **itemListToArr(item_t *);
-size_t displayStrList(const item_t *);
+size_t displayStrList(data_t *, const item_t *);
 item_t *findNodeWithPrefix(item_t *, char *, char);
 ssize_t findNodeIndex(item_t *, item_t *);
 
 /* Linked list handler functions 2*/
 item_t *prependNodeToList(item_t **, const char *, int);
 item_t *appendNodeToList(item_t **, const char *, int);
-size_t displayList(const item_t *);
+size_t displayList(data_t *, const item_t *);
 int removeNodeAtIdx(item_t **, unsigned int);
 void freeLinkedList(item_t **);
 
@@ -133,12 +951,14 @@ int strLength(char *);
 int cmpStr(char *, char *);
 char *findPrefix(const char *, const char *);
 char *concatStr(char *, char *);
+unsigned int hashStrN(const char *, int);
 
 /* Custom String functions 2 */
 char *copyStr(char *, char *);
 char *dupStr(const char *);
-void putStr(char *);
-int putChar(char);
+void putStr(data_t *, char *);
+int putChar(data_t *, char);
+strbuf_t *setOutputCapture(data_t *, strbuf_t *);
 
 /* String Utilities 1 */
 int handleInteractive(data_t *data);
@@ -150,27 +970,109 @@ int convToInt(char *);
 char *copySubstr(char *, char *, int);
 char *concatSubstr(char *, char *, int);
 char *findChar(char *, char);
+int cmpStrN(char *, char *, int);
 
 /* Error handling functions */
-void printErrStr(char *);
-int printErrChar(char);
-int printCharToDesc(char, int);
-int printStrToDesc(char *str, int descriptor);
+void printErrStr(data_t *, char *);
+int printErrChar(data_t *, char);
+int printCharToDesc(data_t *, char, int);
+int printStrToDesc(data_t *, char *str, int descriptor);
 
 /* Error handling functions 2 */
 void printShellErr(data_t *, char *);
 int errStrToInt(char *);
-int printDecimal(int, int);
-char *convertNum(long int, int, int);
+int printDecimal(data_t *, int, int);
+char *convertNum(data_t *, long int, int, int);
 void removeComments(char *);
 
 /* Variable substitution functions */
-int expandCmdAlias(data_t *);
-int expandVariables(data_t *);
-int isCommandChained(data_t *, char *, size_t *);
-void handleCommandChaining(data_t *, char *, size_t *, size_t, size_t);
+void expandCmdWords(data_t *, char **, int, char ***, int *, int *);
 int updateStrPtr(char **, char *);
 
+/* Variable lookup functions */
+int rebuildVarIndex(data_t *);
+item_t *findVarNode(data_t *, const char *, int);
+char *lookupVar(data_t *, const char *, int);
+int isNameChar(char, int);
+char *paramValue(data_t *, const char *, int);
+
+/* Positional parameter functions */
+char *positionalValue(data_t *, const char *, int);
+void expandPositional(data_t *, char);
+void appendParam(data_t *, char *, int);
+
+/* Word expansion functions */
+int appendExpBuf(data_t *, const char *, size_t);
+int expandBraced(data_t *, char *);
+int expandParam(data_t *, char *);
+void expandInto(data_t *, char *);
+int expandWord(data_t *, char *);
+
+/* Quote removal functions */
+int expandDoubleQuoted(data_t *, char *);
+int expandQuoted(data_t *, char *);
+char *expandPattern(data_t *, char *, int);
+
+/* Parameter expansion parsing functions */
+int paramNameLen(char *);
+int findBraceEnd(char *, int);
+int findPatternEnd(char *, int, char);
+int nameLength(char *);
+
+/* Parameter expansion operator functions */
+char *expandOperand(data_t *, char *, int);
+void expandError(data_t *, char *);
+void trimValue(data_t *, char *, char *, char *);
+void replaceValue(data_t *, char *, char *, char *, int);
+void defaultValue(data_t *, char *, int, char *, char *, char *);
+int applyParamOp(data_t *, char *, int, char *, int);
+
+/* Arithmetic lexer functions */
+int arithParseNumber(char *, long *);
+int arithLexOp(char *, int *);
+int arithLex(arith_parser_t *);
+int arithPrec(int);
+int arithAssignOp(int);
+
+/* Arithmetic parser functions */
+int arithAddNode(arith_parser_t *, int, int, int, int);
+int arithParsePrimary(arith_parser_t *);
+int arithParseUnary(arith_parser_t *);
+int arithParseBinary(arith_parser_t *, int);
+int arithParseExpr(arith_parser_t *);
+
+/* Arithmetic evaluation functions */
+long arithVarGet(data_t *, arith_node_t *);
+long arithVarSet(data_t *, arith_node_t *, long);
+long arithApply(int, long, long, int *);
+long arithEvalNode(data_t *, arith_expr_t *, int, int *);
+int arithLoadParams(data_t *, arith_expr_t *);
+
+/* Arithmetic expansion functions */
+int findArithEnd(char *);
+void clearArithCache(data_t *);
+arith_expr_t *parseArith(char *);
+arith_expr_t *compileArith(data_t *, char *, int);
+int expandArith(data_t *, char *);
+
+/* Pattern matching functions */
+int matchBracket(char *, char, int *);
+int matchElem(char *, char, int *);
+int matchPattern(char *, char *, int);
+int hasGlobChars(char *);
+char *removeEscapes(char *);
+
+/* Pathname expansion functions */
+void sortNames(char **, int);
+glob_dir_t *readDirListing(char *);
+glob_dir_t *getDirListing(data_t *, char *);
+void clearGlobCache(data_t *);
+char *joinPath(char *, char *, int, int);
+void globLiteral(glob_state_t *, char *, char *, int, char *);
+void globPath(glob_state_t *, char *, char *);
+int isDirectory(char *);
+void expandGlob(data_t *, char *, char ***, int *, int *);
+
 /* Built-in command functions */
 int exitShell(data_t *);
 int changeDir(data_t *);
@@ -180,20 +1082,334 @@ int dispHelp(data_t *);
 int dispHistory(data_t *);
 int manageAlias(data_t *);
 
+/* Printing built-in functions */
+int echoCmd(data_t *);
+int pwdCmd(data_t *);
+
+/* Command lookup built-in functions */
+int typeCmd(data_t *);
+int commandCmd(data_t *);
+int whichCmd(data_t *);
+
 /* Memory Utilities */
 void freeStrArr(char **);
+int appendStrBuf(strbuf_t *, const char *, size_t);
 void *memRealloc(void *, unsigned int, unsigned int);
 char *fillMemWithByte(char *, char, unsigned int);
 
+/* In-process command line functions */
+void saveCmdState(data_t *, cmd_state_t *);
+void restoreCmdState(data_t *, cmd_state_t *);
+int evalCmdLine(data_t *, char *);
+
+/* Command substitution functions */
+int findSubstEnd(char *, int);
+void captureFromChild(data_t *, program_t *, strbuf_t *);
+void captureOutput(data_t *, char *, strbuf_t *);
+void unescapeBackquoted(char *, int);
+int expandCmdSubst(data_t *, char *);
+
+/* Field splitting functions */
+int pushArg(char ***, int *, int *, char *);
+void pushField(data_t *, char ***, int *, int *, char *);
+void markFields(data_t *, size_t);
+void splitFields(data_t *, char ***, int *, int *);
+void expandWords(data_t *, char **, char ***, int *, int *);
+
 /* Free Memory Function */
 int freePointer(void **);
 
+/* Builtin lookup functions */
+unsigned int hashBuiltinName(const char *);
+const BuiltinCommand *findBuiltin(char *);
+
 /* Shell loop functions */
 void createChildProcessAndExec(data_t *);
 int runShell(data_t *, char **);
-int searchAndExecBuiltin(data_t *);
+void runPrograms(data_t *);
+void runArgv(data_t *);
 void locateAndExecCmd(data_t *);
 
+/* Program arena functions */
+program_t *newProgram(void);
+void *arenaAlloc(program_t *, size_t);
+char *arenaStrN(program_t *, char *, int);
+program_t *retainProgram(program_t *);
+void releaseProgram(program_t *);
+
+/* Lexer functions */
+void skipBlanks(parser_t *);
+int lexOperator(parser_t *);
+int lexToken(parser_t *);
+int isWord(parser_t *, char *);
+void skipNewlines(parser_t *);
+
+/* Redirection parser functions */
+int lexRedir(parser_t *);
+char *hereDelim(parser_t *, int *);
+int parseRedir(parser_t *, redir_t **);
+void unescapeHereDoc(char *);
+void readHereDocs(parser_t *);
+
+/* Parser functions */
+node_t *newNode(parser_t *, int, node_t *, node_t *);
+void syntaxError(parser_t *);
+int expectWord(parser_t *, char *);
+void printSyntaxErr(data_t *, int, char *);
+int parseProgram(data_t *, char *, int, program_t **);
+
+/* List parser functions */
+int isListEnd(parser_t *);
+node_t *parseList(parser_t *);
+node_t *parseAndOr(parser_t *);
+node_t *parseCommand(parser_t *);
+
+/* Pipeline and subshell parser functions */
+node_t *parsePipeline(parser_t *);
+node_t *parseSubshell(parser_t *);
+
+/* Concurrent block parser functions */
+void parseAfter(parser_t *, node_t *);
+node_t *parseStep(parser_t *);
+node_t *parseConcurrent(parser_t *);
+
+/* Concurrent step functions */
+int findStep(node_t *, char *);
+char *stepLabel(node_t *);
+int buildSteps(data_t *, node_t *, step_t **, int **);
+int stepReady(step_t *, int *, int);
+
+/* Concurrent block functions */
+int scheduleSteps(data_t *, step_t *, int *, int, par_job_t *, int);
+void reapSteps(step_t *, par_job_t *, int, int *);
+int runSteps(data_t *, step_t *, int *, int, par_job_t *, int);
+void execConcurrent(data_t *, node_t *);
+
+/* Simple command and case parser functions */
+int addWord(parser_t *, char ***, int *, int *);
+node_t *parseSimple(parser_t *);
+node_t *parseCaseItem(parser_t *);
+node_t *parseCase(parser_t *);
+
+/* Function definition parser functions */
+int isFuncDef(parser_t *);
+node_t *parseFuncDef(parser_t *);
+
+/* Compound command parser functions */
+node_t *parseDoGroup(parser_t *);
+node_t *parseIf(parser_t *);
+node_t *parseLoop(parser_t *);
+node_t *parseFor(parser_t *);
+node_t *parseGroup(parser_t *);
+
+/* Executor functions */
+int execProgram(data_t *, program_t *);
+int execNode(data_t *, node_t *);
+int execCommand(data_t *, node_t *);
+void execIf(data_t *, node_t *);
+
+/* Compound command executor functions */
+int loopDone(data_t *);
+void execLoop(data_t *, node_t *);
+void execFor(data_t *, node_t *);
+int caseMatches(data_t *, node_t *, char *);
+void execCase(data_t *, node_t *);
+
+/* Shell function functions */
+func_t *findFunc(data_t *, char *);
+int defineFunc(data_t *, node_t *);
+void clearFuncs(data_t *);
+int callFunction(data_t *, func_t *);
+void popLocals(data_t *);
+
+/* Function built-in functions */
+void saveLocal(data_t *, char *);
+int localCmd(data_t *);
+int returnCmd(data_t *);
+int shiftCmd(data_t *);
+
+/* Sourced file cache functions */
+char *readFileText(int, size_t);
+void cacheSource(data_t *, source_t *, struct stat *, program_t *);
+int loadSource(data_t *, char *, program_t **);
+void clearSourceCache(data_t *);
+
+/* Source built-in functions */
+char *findSourcePath(data_t *, char *);
+int runSource(data_t *, program_t *);
+int sourceCmd(data_t *);
+
+/* Read built-in input functions */
+int readStep(read_state_t *, char);
+int readShellInput(data_t *, read_state_t *);
+int readSeekable(int, read_state_t *);
+int readBytewise(int, read_state_t *);
+int readRecord(data_t *, read_state_t *);
+
+/* Read built-in functions */
+int parseReadOpts(data_t *, read_state_t *);
+void assignReadFields(data_t *, char **, char *);
+int readCmd(data_t *);
+
+/* In-process check functions */
+int isBuiltinCmd(data_t *, node_t *, int);
+int isBuiltinOnly(data_t *, node_t *, int);
+
+/* Subshell snapshot functions */
+item_t *copyList(item_t *);
+void beginSnapshot(data_t *, snapshot_t *);
+void touchSnapshot(data_t *, int);
+void endSnapshot(data_t *, snapshot_t *);
+int runSubshell(data_t *, node_t *, strbuf_t *);
+
+/* Pipeline and subshell functions */
+pid_t forkNode(data_t *, node_t *, int *);
+int waitChild(data_t *, pid_t);
+pid_t runStage(data_t *, node_t *, int, pipe_state_t *);
+void execPipeline(data_t *, node_t *);
+void execSubshell(data_t *, node_t *);
+
+/* Job pool functions */
+void exitChild(data_t *);
+pid_t forkJob(data_t *, par_job_t *);
+void collectOutput(par_job_t *, struct pollfd *, int);
+int finishJobs(data_t *, par_job_t *, int, int *);
+
+/* Parallel job functions */
+char **jobArgv(char **, char *);
+void runJob(data_t *, char **);
+int startJob(data_t *, par_job_t *, char **, char *);
+
+/* Parallel built-in functions */
+int parseParallelOpts(data_t *, int *);
+int readItems(data_t *, char ***, int *, int *);
+int runParallel(data_t *, char **, char **, int, int);
+int parallelCmd(data_t *);
+
+/* Script job functions */
+int openScript(data_t *, char *);
+void runScriptJob(data_t *, char *);
+int reapScripts(data_t *, par_job_t *, int, char **);
+int runScriptPool(data_t *, char **, int, par_job_t *, int);
+int runScripts(data_t *, char **);
+
+/* Output sink functions */
+int openSink(data_t *, hsh_sink_fn, void *);
+void writeOut(data_t *, int, char *, size_t);
+void detachSink(data_t *, int *);
+void readSink(data_t *);
+void drainSink(data_t *, pid_t);
+
+/* Library session descriptor functions */
+int sessionFd(data_t *, int);
+int dupSessionFd(data_t *, int);
+int mapRedirs(data_t *, redir_t *, int *);
+void unmapRedirs(data_t *, int *, int);
+void placeSessionFds(data_t *, int *);
+
+/* Socket I/O functions */
+int sendAll(int, const char *, size_t);
+int readAll(int, char *, size_t);
+int sendFrame(int, char, const char *, size_t);
+int openSocket(char *, int);
+
+/* Command server functions */
+void sendToClient(void *, int, const char *, size_t);
+void serveClient(int);
+void runWorker(int, int);
+int serveShell(data_t *, char **);
+int readRequest(strbuf_t *, char **);
+int relayReply(int);
+int runClient(data_t *, char **);
+
+/* Resource usage functions */
+long nowNanos(void);
+void addUsage(usage_t *, struct rusage *);
+void startUsage(data_t *, usage_t *);
+void endUsage(data_t *, usage_t *, usage_t *);
+char *usageValue(data_t *, const char *, int);
+void printDuration(data_t *, char *, long);
+void execTimed(data_t *, node_t *);
+
+/* Statistics functions */
+void addPhaseTime(stats_t *, int, long);
+int startStats(data_t *);
+void printField(data_t *, long, int);
+void printPhases(data_t *);
+void printHistogram(data_t *, int);
+void printCounters(data_t *);
+void printCommands(data_t *);
+int statsCmd(data_t *);
+
+/* Metrics file functions */
+void startMetrics(data_t *);
+void countCommand(data_t *, long, int);
+void countStages(data_t *, pid_t *, int, long);
+void writeMetrics(data_t *);
+int appendFixed(data_t *, strbuf_t *, long, int);
+int appendMetric(data_t *, strbuf_t *, char *, char *, char *, long, int);
+int formatMetrics(data_t *, strbuf_t *);
+
+/* Execution trace functions */
+int traceChar(data_t *, char);
+void traceStr(data_t *, char *);
+void traceFixed(data_t *, long, int);
+void traceCommand(data_t *, long);
+void startTrace(data_t *, int);
+int setCmd(data_t *);
+
+/* Start-up functions */
+void initSession(data_t *, int);
+int runMode(data_t *, int, char **);
+
+/* Command string functions */
+node_t *tailCommand(node_t *);
+void execInPlace(data_t *);
+int runCmdString(data_t *, char **);
+
+/* Zygote functions */
+void startZygote(data_t *);
+void runZygote(int, int);
+int packRequest(strbuf_t *, int, char *, char **, char **);
+pid_t sendRequest(int, strbuf_t *, int *, int);
+pid_t zygoteSpawn(data_t *, char *, char **, char **);
+char **unpackStrings(char **, int);
+void placeFds(int *, int, int);
+ssize_t takeRequest(int, char *, int *, int *);
+void parkChild(int, int);
+
+/* Redirection functions */
+int openRedir(data_t *, redir_t *);
+int applyRedirs(data_t *, redir_t *, int *);
+void restoreRedirs(data_t *, int *, int);
+int execRedirected(data_t *, node_t *);
+
+/* Here-document functions */
+void expandHereDoc(data_t *, char *);
+int hereDocFd(char *, size_t);
+int openHereDoc(data_t *, redir_t *);
+
+/* Simple command executor functions */
+int isAssignment(char *);
+void assignVars(data_t *, char **, int, char **);
+void restoreVars(data_t *, char **, int, char **);
+int hasCmdSubst(char **, int);
+int execSimpleCmd(data_t *, node_t *);
+
+/* Control flow built-in functions */
+int trueCmd(data_t *);
+int falseCmd(data_t *);
+int loopJump(data_t *, int);
+int breakCmd(data_t *);
+int continueCmd(data_t *);
+
+/* Test built-in functions */
+int testInt(data_t *, char *, long *);
+int testUnary(char *, char *);
+int testBinary(data_t *, char *, char *, char *);
+int testEval(data_t *, char **, int);
+int testCmd(data_t *);
+
 /* Environment Operation Handlers */
 int rmvEnvVar(data_t *, char *);
 int initEnvVar(data_t *, char *, char *);
@@ -206,22 +1422,30 @@ int initEnvironVar(data_t *);
 int rmvEnvironVar(data_t *);
 int initEnvList(data_t *);
 
+/* Command resolution functions */
+int resolveCommand(data_t *, char *, int, resolved_t *);
+void clearCmdCache(data_t *);
+
 /* Command Utilities */
 int isBuiltinCommand(data_t *, char *);
-char *copyCharacters(char *, int, int);
+char *copyCharacters(char *, char *, int, int);
 char *findCmdInPath(data_t *, char *, char *);
 
 /* Custom String Tokenizer Functions */
 char **strTokenize(char *, char *);
 char **strTokenizeDel(char *, char);
+int scanWord(char *, char *, int *);
+int wordLength(char *, char *);
+char **splitWords(char *, char *);
 
 /* Getline functions */
-ssize_t getInput(data_t *);
+ssize_t readInputLine(data_t *, char **);
+int readProgram(data_t *, program_t **);
+ssize_t readBuffer(data_t *, char *, size_t *);
 int getLine(data_t *, char **, size_t *);
 void handleSignalInterrupt(int);
 
 /* Get shell information functions */
-void initShellData(data_t *, char **);
 void freeShellData(data_t *, int);
 void clearShellData(data_t *);
 
@@ -4,8 +4,8 @@
  * exitShell - Exits the shell with a specified exit status.
  * @data: Pointer to structure containing optional arguments.
  *
- * Return: 0 if no arguments provided, -2 if custom exit status if specified,
- * or 1 on error.
+ * Return: -2 to exit the shell, or 2 if the exit status is not a valid
+ * number.
  */
 
 int exitShell(data_t *data)
@@ -19,9 +19,9 @@ int exitShell(data_t *data)
 		{
 			data->execStat = 2;
 			printShellErr(data, "Invalid number: ");
-			printErrStr(data->argv[1]);
-			printErrChar('\n');
-			return (1);
+			printErrStr(data, data->argv[1]);
+			printErrChar(data, '\n');
+			return (2);
 		}
 		data->errorCode = errStrToInt(data->argv[1]);
 		return (-2);
@@ -46,9 +46,10 @@ int changeDir(data_t *data)
 	char *currentDir, *newDir, buffer[1024];
 	int chdirResult;
 
+	touchSnapshot(data, SNAP_CWD);
 	currentDir = getcwd(buffer, 1024);
 	if (!currentDir)
-		putStr("TODO: >>getcwd failure emsg here<<\n");
+		putStr(data, "TODO: >>getcwd failure emsg here<<\n");
 	if (!data->argv[1])
 	{
 		newDir = getEnvironVar(data, "HOME=");
@@ -62,11 +63,11 @@ int changeDir(data_t *data)
 	{
 		if (!getEnvironVar(data, "OLDPWD="))
 		{
-			putStr(currentDir);
-			putChar('\n');
+			putStr(data, currentDir);
+			putChar(data, '\n');
 			return (1);
 		}
-		putStr(getEnvironVar(data, "OLDPWD=")), putChar('\n');
+		putStr(data, getEnvironVar(data, "OLDPWD=")), putChar(data, '\n');
 		chdirResult =
 			chdir((newDir = getEnvironVar(data, "OLDPWD=")) ? newDir : "/");
 	}
@@ -75,7 +76,7 @@ int changeDir(data_t *data)
 	if (chdirResult == -1)
 	{
 		printShellErr(data, "Cannot cd to ");
-		printErrStr(data->argv[1]), printErrChar('\n');
+		printErrStr(data, data->argv[1]), printErrChar(data, '\n');
 	}
 	else
 	{
@@ -100,8 +101,8 @@ int dispHelp(data_t *data)
 	char **argArray;
 
 	argArray = data->argv;
-	putStr("This function has not been implemented yet.\n");
+	putStr(data, "This function has not been implemented yet.\n");
 	if (0)
-		putStr(*argArray);
+		putStr(data, *argArray);
 	return (0);
 }
@@ -1,43 +1,5 @@
 #include "shell.h"
 
-/**
- * initShellData - Initializes the data_t struct with command-line arguments.
- * @data: Pointer to the structure to be initialized.
- * @argVect: Argument vector containing command-line arguments.
- *
- * This function initializes the 'data_t' structure with information
- * from the command-line arguments, including the program name, argument count,
- * and argument vector. It also processes and replaces aliases and variables
- * in the provided arguments.
- *
- * Return: Nothing.
- */
-
-void initShellData(data_t *data, char **argVect)
-{
-	int argIndex = 0;
-
-	data->fName = argVect[0];
-	if (data->arg)
-	{
-		data->argv = strTokenize(data->arg, " \t");
-		if (!data->argv)
-		{
-			data->argv = malloc(sizeof(char *) * 2);
-			if (data->argv)
-			{
-				data->argv[0] = dupStr(data->arg);
-				data->argv[1] = NULL;
-			}
-		}
-		for (argIndex = 0; data->argv && data->argv[argIndex]; argIndex++)
-			;
-		data->argc = argIndex;
-		expandCmdAlias(data);
-		expandVariables(data);
-	}
-}
-
 /**
  * freeShellData - Frees resources of data_t struct.
  * @data: Pointer to the structure whose resources needs to be freed.
@@ -55,11 +17,10 @@ void freeShellData(data_t *data, int freeAll)
 	freeStrArr(data->argv);
 	data->argv = NULL;
 	data->commandPath = NULL;
+	clearGlobCache(data);
 
 	if (freeAll)
 	{
-		if (!data->cmdBuf)
-			free(data->arg);
 		if (data->envList)
 			freeLinkedList(&(data->envList));
 		if (data->historyList)
@@ -68,10 +29,26 @@ void freeShellData(data_t *data, int freeAll)
 			freeLinkedList(&(data->aliasList));
 		freeStrArr(data->environ);
 		data->environ = NULL;
-		freePointer((void **)data->cmdBuf);
+		clearCmdCache(data);
+		freePointer((void **)&data->cmdCache);
+		freePointer((void **)&data->varIndex);
+		freePointer((void **)&data->exp.buf);
+		clearArithCache(data);
+		freePointer((void **)&data->arithCache);
+		clearFuncs(data);
+		clearSourceCache(data);
+		freeLinkedList(&data->localVars);
+		freePointer((void **)&data->posJoin.buf);
+		freePointer((void **)&data->stats);
+		freePointer((void **)&data->metrics.path);
+		data->varIndexSize = data->exp.size = data->exp.len = 0;
 		if (data->readDescriptor > 2)
 			close(data->readDescriptor);
-		putChar(FLUSH_BUFFER_FLAG);
+		putChar(data, FLUSH_BUFFER_FLAG);
+		traceChar(data, FLUSH_BUFFER_FLAG);
+		if (data->trace.fd >= 0)
+			close(data->trace.fd);
+		data->trace.fd = -1;
 	}
 }
 
@@ -88,7 +65,6 @@ void freeShellData(data_t *data, int freeAll)
 
 void clearShellData(data_t *data)
 {
-	data->arg = NULL;
 	data->argv = NULL;
 	data->commandPath = NULL;
 	data->argc = 0;
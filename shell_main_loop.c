@@ -6,84 +6,91 @@
  * @argv: The argument vector from the main function.
  *
  * This function represents the main loop of this custom shell program.
- * It continuously processes user input, executes commands, and manages
- * operations.
+ * It reads complete commands, which may span several lines, parses each
+ * one into a command tree and runs it.
  *
  * Return: 0 if successful, or 1 otherwise.
  */
 
 int runShell(data_t *data, char **argv)
 {
-	ssize_t inputReadRet = 0;
-	int builtinCmdRet = 0;
-
-	while (inputReadRet != -1 && builtinCmdRet != -2)
-	{
-		clearShellData(data);
-		if (handleInteractive(data))
-			putStr("$ ");
-		printErrChar(FLUSH_BUFFER_FLAG);
-		inputReadRet = getInput(data);
-		if (inputReadRet != -1)
-		{
-			initShellData(data, argv);
-			builtinCmdRet = searchAndExecBuiltin(data);
-			if (builtinCmdRet == -1)
-				locateAndExecCmd(data);
-		}
-		else if (handleInteractive(data))
-			putChar('\n');
-		freeShellData(data, 0);
-	}
+	data->fName = argv[0];
+	runPrograms(data);
+	if (data->unwind != UNWIND_EXIT && handleInteractive(data))
+		putChar(data, '\n');
 	saveHistoryToFile(data);
+	writeMetrics(data);
+	printErrChar(data, FLUSH_BUFFER_FLAG);
 	freeShellData(data, 1);
-	if (!handleInteractive(data) && data->execStat)
+	if (!handleInteractive(data) && data->unwind != UNWIND_EXIT
+			&& data->execStat)
 		exit(data->execStat);
-	if (builtinCmdRet == -2)
+	if (data->unwind == UNWIND_EXIT)
 	{
 		if (data->errorCode == -1)
 			exit(data->execStat);
 		exit(data->errorCode);
 	}
-	return (builtinCmdRet);
+	return (0);
+}
+
+/**
+ * runPrograms - Reads and runs commands until the input ends or the shell
+ * exits.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: Nothing.
+ */
+
+void runPrograms(data_t *data)
+{
+	program_t *prog;
+
+	while (data->unwind != UNWIND_EXIT && readProgram(data, &prog) != -1)
+	{
+		if (prog)
+			execProgram(data, prog);
+		releaseProgram(prog);
+		data->unwind = (data->unwind == UNWIND_EXIT) ? UNWIND_EXIT : 0;
+	}
 }
 
 /**
- * searchAndExecBuiltin - Searches for and processes a built-in command.
+ * runArgv - Runs the command held in @data->argv.
  * @data: Pointer to the data_t struct containing shell information.
  *
- * This function searches for a built-in command within the input arguments and
- * executes it if found.
+ * Shell functions are looked for first, then builtins, then executables.
+ * Only an executable may replace the shell when this is the command a
+ * command string ends with.
  *
- * Return: 0 if executed successfully,
- *	1 if command is found but not executed successfully,
- *	2 if a command signals an exit() call,
- *	1 if no command is found.
+ * Return: Nothing.
  */
 
-int searchAndExecBuiltin(data_t *data)
+void runArgv(data_t *data)
 {
-	int i, builtinResult = -1;
-	BuiltinCommand builtinTable[] = {
-		{"exit", exitShell},
-		{"env", displayEnv},
-		{"help", dispHelp},
-		{"history", dispHistory},
-		{"setenv", initEnvironVar},
-		{"unsetenv", rmvEnvironVar},
-		{"cd", changeDir},
-		{"alias", manageAlias},
-		{NULL, NULL}
-	};
+	resolved_t cmd;
+	int builtinRet, tail = data->execTail;
+	long start = STATS_BEGIN(data);
 
-	for (i = 0; builtinTable[i].command; i++)
-		if (cmpStr(data->argv[0], builtinTable[i].command) == 0)
-		{
-			data->lineCounter++;
-			builtinResult = builtinTable[i].function(data);
-			break;
-		}
-	return (builtinResult);
+	data->execTail = 0;
+	if (resolveCommand(data, data->argv[0], 1, &cmd) == CMD_FUNCTION)
+	{
+		callFunction(data, cmd.func);
+		return;
+	}
+	builtinRet = cmd.builtin ? cmd.builtin->function(data) : -1;
+	if (builtinRet == -1)
+	{
+		data->execTail = tail;
+		locateAndExecCmd(data);
+		data->execTail = 0;
+	}
+	else if (builtinRet == -2)
+		data->unwind = UNWIND_EXIT;
+	else
+		data->execStat = builtinRet;
+	if (data->stats && start)
+		countCommand(data, start, builtinRet != -1);
 }
 
 /**
@@ -91,33 +98,33 @@ int searchAndExecBuiltin(data_t *data)
  * PATH directories.
  * @data: Pointer to the data_t struct containing shell information.
  *
- * This function locates and executes an executable command by searching in the
- * directories listed in the 'PATH' environment variable.
+ * This function locates and executes an executable command through the
+ * command resolver, which searches the directories listed in the 'PATH'
+ * environment variable and caches the result. A cached path that no longer
+ * exists (the file was removed, or a relative PATH entry means another
+ * directory after cd) is dropped and searched for again.
  *
  * Return: Nothing.
  */
 
 void locateAndExecCmd(data_t *data)
 {
-	char *p = NULL;
-	int argIdx, num;
+	resolved_t cmd;
 
 	data->commandPath = data->argv[0];
-	if (data->lineCounterFlag == 1)
-	{
-		data->lineCounter++;
-		data->lineCounterFlag = 0;
-	}
-	for (argIdx = 0, num = 0; data->arg[argIdx]; argIdx++)
-		if (!isDelim(data->arg[argIdx], " \t\n"))
-			num++;
-	if (!num)
+	if (!data->argv[0])
 		return;
 
-	p = findCmdInPath(data, getEnvironVar(data, "PATH="), data->argv[0]);
-	if (p)
+	resolveCommand(data, data->argv[0], 1, &cmd);
+	STATS_ADD(data, STAT_SYSCALLS, cmd.path != NULL);
+	if (cmd.path && access(cmd.path, F_OK) == -1 && errno == ENOENT)
+	{
+		clearCmdCache(data);
+		resolveCommand(data, data->argv[0], 1, &cmd);
+	}
+	if (cmd.path)
 	{
-		data->commandPath = p;
+		data->commandPath = cmd.path;
 		createChildProcessAndExec(data);
 	}
 	else
@@ -125,7 +132,7 @@ void locateAndExecCmd(data_t *data)
 		if ((handleInteractive(data) || getEnvironVar(data, "PATH=")
 		|| data->argv[0][0] == '/') && isBuiltinCommand(data, data->argv[0]))
 			createChildProcessAndExec(data);
-		else if (*(data->arg) != '\n')
+		else
 		{
 			data->execStat = 127;
 			printShellErr(data, "command not found\n");
@@ -138,6 +145,8 @@ void locateAndExecCmd(data_t *data)
  * @data: Pointer to the data_t struct containing shell information.
  *
  * This function creates a child process using 'fork()' and executes a command.
+ * With a zygote running, one of its parked children runs the command instead,
+ * and the last command of a command string replaces the shell.
  *
  * Return: Nothing.
  */
@@ -145,8 +154,24 @@ void locateAndExecCmd(data_t *data)
 void createChildProcessAndExec(data_t *data)
 {
 	pid_t childProcessId;
+	long start;
 
-	childProcessId = fork();
+	putChar(data, FLUSH_BUFFER_FLAG);
+	traceChar(data, FLUSH_BUFFER_FLAG);
+	if (data->execTail)
+	{
+		execInPlace(data);
+		if (data->execStat == 126)
+			printShellErr(data, "access denied\n");
+		return;
+	}
+	start = STATS_BEGIN(data);
+	childProcessId = zygoteSpawn(data, data->commandPath, data->argv,
+			getEnv(data));
+	if (childProcessId == -1)
+		childProcessId = fork();
+	STATS_END(data, PHASE_SPAWN, start);
+	STATS_ADD(data, STAT_SYSCALLS, 1);
 	if (childProcessId == -1)
 	{
 		perror("Error:");
@@ -154,22 +179,19 @@ void createChildProcessAndExec(data_t *data)
 	}
 	if (childProcessId == 0)
 	{
+		detachSink(data, NULL);
 		if (execve(data->commandPath, data->argv, getEnv(data)) == -1)
 		{
 			freeShellData(data, 1);
 			if (errno == EACCES)
-				exit(126);
-			exit(1);
+				_exit(126);
+			_exit(1);
 		}
 	}
 	else
 	{
-		wait(&(data->execStat));
-		if (WIFEXITED(data->execStat))
-		{
-			data->execStat = WEXITSTATUS(data->execStat);
-			if (data->execStat == 126)
-				printShellErr(data, "access denied\n");
-		}
+		data->execStat = waitChild(data, childProcessId);
+		if (data->execStat == 126)
+			printShellErr(data, "access denied\n");
 	}
 }
@@ -2,12 +2,13 @@
 
 /**
  * putStr - Prints a string to the standard output.
+ * @data: Pointer to the data_t struct containing shell information.
  * @string: The string to be printed.
  *
  * Return: Nothing.
  */
 
-void putStr(char *string)
+void putStr(data_t *data, char *string)
 {
 	int index = 0;
 
@@ -16,32 +17,39 @@ void putStr(char *string)
 
 	while (string[index] != '\0')
 	{
-		putChar(string[index]);
+		putChar(data, string[index]);
 		index++;
 	}
 }
 
 /**
  * putChar - Writes a character to the standard output.
+ * @data: Pointer to the data_t struct containing shell information.
  * @character: The character to print.
  *
+ * Each session buffers its output separately. While an output capture is
+ * set, flushed output is appended to the
+ * capture buffer instead of being written to the standard output.
+ *
  * Return: 1 on success, -1 if error occurs with errno set accordingly.
  */
 
-int putChar(char character)
+int putChar(data_t *data, char character)
 {
-	static char buffer[WRITE_BUFFER_SIZE];
-	static int index;
+	outbuf_t *out = &data->out;
 
-	if (character == FLUSH_BUFFER_FLAG || index >= WRITE_BUFFER_SIZE)
+	if (character == FLUSH_BUFFER_FLAG || out->len >= WRITE_BUFFER_SIZE)
 	{
-		write(1, buffer, index);
-		index = 0;
+		if (data->capture)
+			appendStrBuf(data->capture, out->buf, out->len);
+		else
+			writeOut(data, 1, out->buf, out->len);
+		out->len = 0;
 	}
 
 	if (character != FLUSH_BUFFER_FLAG)
 	{
-		buffer[index++] = character;
+		out->buf[out->len++] = character;
 	}
 
 	return (1);
@@ -102,3 +110,23 @@ char *dupStr(const char *originalStr)
 
 	return (dupStr);
 }
+
+/**
+ * setOutputCapture - Redirects standard output into a memory buffer.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @capture: The buffer to capture into, or NULL to write to fd 1 again.
+ *
+ * Pending output is flushed to its current destination first, so nothing
+ * written before the switch ends up in the wrong place.
+ *
+ * Return: The previous capture buffer (NULL if none), so captures can nest.
+ */
+
+strbuf_t *setOutputCapture(data_t *data, strbuf_t *capture)
+{
+	strbuf_t *previous = data->capture;
+
+	putChar(data, FLUSH_BUFFER_FLAG);
+	data->capture = capture;
+	return (previous);
+}
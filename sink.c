@@ -0,0 +1,169 @@
+#include "shell.h"
+
+/**
+ * openSink - Sends a session's output to a caller's function.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @write: The function receiving the output.
+ * @ctx: Context pointer passed to @write.
+ *
+ * Output of the shell itself goes straight to @write. Child processes
+ * write to a pair of pipes instead, which the shell drains into @write
+ * while it waits for them.
+ *
+ * Return: 0 on success, or -1 on error.
+ */
+
+int openSink(data_t *data, hsh_sink_fn write, void *ctx)
+{
+	sink_t *sink = malloc(sizeof(sink_t));
+	int idx, fds[2];
+
+	if (!sink)
+		return (-1);
+	sink->write = write;
+	sink->ctx = ctx;
+	for (idx = 0; idx < 2; idx++)
+	{
+		if (pipe(fds) == -1)
+		{
+			if (idx)
+				close(sink->readFds[0]), close(sink->writeFds[0]);
+			free(sink);
+			return (-1);
+		}
+		fcntl(fds[0], F_SETFL, O_NONBLOCK);
+		fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+		fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+		sink->readFds[idx] = fds[0];
+		sink->writeFds[idx] = fds[1];
+	}
+	data->sink = sink;
+	return (0);
+}
+
+/**
+ * writeOut - Writes output of the shell to one of its descriptors.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @fd: 1 or 2.
+ * @buf: The bytes to write.
+ * @len: Number of bytes.
+ *
+ * In a library session @fd goes wherever the session's descriptor map
+ * says, which is the sink's function unless it was redirected.
+ *
+ * Return: Nothing.
+ */
+
+void writeOut(data_t *data, int fd, char *buf, size_t len)
+{
+	if (!len)
+		return;
+	STATS_ADD(data, STAT_SYSCALLS, 1);
+	if (data->fdMap)
+		fd = (fd >= 0 && fd < SESSION_FDS) ? data->fdMap[fd] : -1;
+	if (fd == FD_SINK_OUT || fd == FD_SINK_ERR)
+		data->sink->write(data->sink->ctx, fd == FD_SINK_OUT ? 1 : 2, buf,
+				len);
+	else if (fd >= 0)
+		write(fd, buf, len);
+}
+
+/**
+ * detachSink - Sets up the standard descriptors of a new child process.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @stdio: Descriptors to use as the child's 0, 1 and 2 (-1 to keep the
+ * shell's), closed once placed; or NULL.
+ *
+ * Called first thing in every child. In a library session the child gets
+ * the descriptors of the session's map, with the sink's pipes for those
+ * going to the sink, and from then on works like the shell itself. The
+ * child drops the trace lines it inherited, which the parent writes.
+ *
+ * Return: Nothing.
+ */
+
+void detachSink(data_t *data, int *stdio)
+{
+	int fd = data->trace.fd;
+
+	data->trace.out.len = 0;
+	if (data->fdMap)
+	{
+		if (fd == FD_SINK_OUT || fd == FD_SINK_ERR)
+			data->trace.fd = fcntl(data->sink->writeFds[fd == FD_SINK_ERR],
+					F_DUPFD_CLOEXEC, SESSION_FDS);
+		placeSessionFds(data, stdio);
+		free(data->fdMap);
+		data->fdMap = NULL;
+		data->sink = NULL;
+		return;
+	}
+	for (fd = 0; stdio && fd < 3; fd++)
+		if (stdio[fd] != -1 && stdio[fd] != fd)
+		{
+			dup2(stdio[fd], fd);
+			close(stdio[fd]);
+		}
+}
+
+/**
+ * readSink - Passes on what child processes have written to the sink
+ * pipes so far.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: Nothing.
+ */
+
+void readSink(data_t *data)
+{
+	char buffer[READ_BUFFER_SIZE * 4];
+	ssize_t bytes;
+	int idx;
+
+	for (idx = 0; idx < 2; idx++)
+		while ((bytes = read(data->sink->readFds[idx], buffer,
+						sizeof(buffer))) > 0)
+			data->sink->write(data->sink->ctx, idx + 1, buffer, bytes);
+}
+
+/**
+ * drainSink - Passes on the output of child processes until one exits.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @pid: The child waited for; it is left for wait4() to reap.
+ *
+ * A pidfd wakes the loop when the child exits; on kernels without one the
+ * child is checked every 10 milliseconds.
+ *
+ * Return: Nothing.
+ */
+
+void drainSink(data_t *data, pid_t pid)
+{
+	struct pollfd polls[3];
+	siginfo_t info;
+	int idx, pidFd = -1;
+
+#ifdef SYS_pidfd_open
+	pidFd = syscall(SYS_pidfd_open, pid, 0);
+#endif
+	for (idx = 0; idx < 3; idx++)
+	{
+		polls[idx].fd = idx < 2 ? data->sink->readFds[idx] : pidFd;
+		polls[idx].events = POLLIN;
+	}
+	while (1)
+	{
+		polls[2].revents = 0;
+		info.si_pid = 0;
+		if (poll(polls, 3, pidFd == -1 ? 10 : -1) == -1 && errno != EINTR)
+			break;
+		readSink(data);
+		if (pidFd != -1 ? polls[2].revents != 0
+				: (waitid(P_PID, pid, &info, WEXITED | WNOHANG | WNOWAIT) == -1
+					|| info.si_pid == pid))
+			break;
+	}
+	readSink(data);
+	if (pidFd != -1)
+		close(pidFd);
+}
@@ -0,0 +1,140 @@
+#include "shell.h"
+
+/**
+ * copyList - Copies a list of strings.
+ * @head: The list.
+ *
+ * Return: The copy (NULL for an empty list).
+ */
+
+item_t *copyList(item_t *head)
+{
+	item_t *copy = NULL;
+
+	for (; head; head = head->next)
+		appendNodeToList(&copy, head->string, head->number);
+	return (copy);
+}
+
+/**
+ * beginSnapshot - Starts running a subshell inside the shell process.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @snap: The snapshot to fill.
+ *
+ * Nothing is copied yet: the variables, aliases and working directory are
+ * saved by touchSnapshot() only when the subshell first changes them, so
+ * a subshell that changes nothing costs no copying at all.
+ *
+ * Return: Nothing.
+ */
+
+void beginSnapshot(data_t *data, snapshot_t *snap)
+{
+	snap->env = snap->aliases = NULL;
+	snap->envSaved = snap->aliasSaved = 0;
+	snap->cwdFd = -1;
+	snap->posArgs = data->posArgs;
+	snap->posCount = data->posCount;
+	snap->loopDepth = data->loopDepth;
+	snap->errorCode = data->errorCode;
+	snap->outer = data->snapshot;
+	data->loopDepth = 0;
+	data->snapshot = snap;
+}
+
+/**
+ * touchSnapshot - Saves part of the shell state before it is changed.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @what: SNAP_ENV, SNAP_ALIAS or SNAP_CWD.
+ *
+ * Only the innermost snapshot saves anything: it undoes the change before
+ * the outer ones can see it.
+ *
+ * Return: Nothing.
+ */
+
+void touchSnapshot(data_t *data, int what)
+{
+	snapshot_t *snap = data->snapshot;
+
+	if (!snap)
+		return;
+	if (what == SNAP_ENV && !snap->envSaved)
+	{
+		snap->env = copyList(data->envList);
+		snap->envSaved = 1;
+	}
+	else if (what == SNAP_ALIAS && !snap->aliasSaved)
+	{
+		snap->aliases = copyList(data->aliasList);
+		snap->aliasSaved = 1;
+	}
+	else if (what == SNAP_CWD && snap->cwdFd == -1)
+		snap->cwdFd = open(".", O_RDONLY | O_CLOEXEC);
+}
+
+/**
+ * endSnapshot - Finishes a subshell run in-process and restores the state
+ * it changed.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @snap: The snapshot.
+ *
+ * An exit, break, continue or return only ends the subshell.
+ *
+ * Return: Nothing.
+ */
+
+void endSnapshot(data_t *data, snapshot_t *snap)
+{
+	if (data->unwind == UNWIND_EXIT && data->errorCode != -1)
+		data->execStat = data->errorCode;
+	data->unwind = 0;
+	data->errorCode = snap->errorCode;
+	if (snap->envSaved)
+	{
+		freeLinkedList(&data->envList);
+		data->envList = snap->env;
+		data->envChanged = 1;
+		data->varIndexValid = 0;
+	}
+	if (snap->aliasSaved)
+	{
+		freeLinkedList(&data->aliasList);
+		data->aliasList = snap->aliases;
+	}
+	if (snap->envSaved || snap->aliasSaved)
+		clearCmdCache(data);
+	if (snap->cwdFd != -1)
+	{
+		fchdir(snap->cwdFd);
+		close(snap->cwdFd);
+	}
+	data->posArgs = snap->posArgs;
+	data->posCount = snap->posCount;
+	data->loopDepth = snap->loopDepth;
+	data->snapshot = snap->outer;
+}
+
+/**
+ * runSubshell - Runs a command tree as a subshell inside the shell process.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The tree; see isBuiltinOnly() for what it may contain.
+ * @capture: Buffer to collect the standard output in, or NULL.
+ *
+ * Return: The exit status of the subshell.
+ */
+
+int runSubshell(data_t *data, node_t *node, strbuf_t *capture)
+{
+	snapshot_t snap;
+	strbuf_t *previous = NULL;
+
+	beginSnapshot(data, &snap);
+	if (capture)
+		previous = setOutputCapture(data, capture);
+	execNode(data, node);
+	if (capture)
+		setOutputCapture(data, previous);
+	endSnapshot(data, &snap);
+	return (data->execStat);
+}
@@ -0,0 +1,131 @@
+#include "shell.h"
+
+/**
+ * sendAll - Writes a whole buffer to a socket.
+ * @fd: The socket.
+ * @buf: The bytes.
+ * @len: Number of bytes.
+ *
+ * A peer that has gone away makes this fail rather than raise SIGPIPE.
+ *
+ * Return: 0 on success, or -1 on error.
+ */
+
+int sendAll(int fd, const char *buf, size_t len)
+{
+	ssize_t bytes;
+
+	while (len)
+	{
+		bytes = send(fd, buf, len, MSG_NOSIGNAL);
+		if (bytes == -1 && errno == EINTR)
+			continue;
+		if (bytes <= 0)
+			return (-1);
+		buf += bytes;
+		len -= bytes;
+	}
+	return (0);
+}
+
+/**
+ * readAll - Reads exactly a given number of bytes from a descriptor.
+ * @fd: The descriptor.
+ * @buf: Where to store the bytes.
+ * @len: Number of bytes.
+ *
+ * Return: 0 on success, or -1 on error or if the input ends first.
+ */
+
+int readAll(int fd, char *buf, size_t len)
+{
+	ssize_t bytes;
+
+	while (len)
+	{
+		bytes = read(fd, buf, len);
+		if (bytes == -1 && errno == EINTR)
+			continue;
+		if (bytes <= 0)
+			return (-1);
+		buf += bytes;
+		len -= bytes;
+	}
+	return (0);
+}
+
+/**
+ * sendFrame - Sends one frame of a command server reply.
+ * @fd: The connection.
+ * @type: FRAME_STDOUT, FRAME_STDERR or FRAME_STATUS.
+ * @buf: The payload.
+ * @len: Number of bytes in @buf.
+ *
+ * A frame is its type byte, its length as four big-endian bytes, then the
+ * payload.
+ *
+ * Return: 0 on success, or -1 on error.
+ */
+
+int sendFrame(int fd, char type, const char *buf, size_t len)
+{
+	char header[FRAME_HEADER_SIZE];
+
+	header[0] = type;
+	header[1] = (len >> 24) & 0xff;
+	header[2] = (len >> 16) & 0xff;
+	header[3] = (len >> 8) & 0xff;
+	header[4] = len & 0xff;
+	if (sendAll(fd, header, FRAME_HEADER_SIZE) == -1)
+		return (-1);
+	return (sendAll(fd, buf, len));
+}
+
+/**
+ * openSocket - Opens a Unix domain stream socket.
+ * @path: The socket's path.
+ * @server: True to listen on it (replacing a stale socket file), false to
+ * connect to it.
+ *
+ * A server never removes anything but a socket at @path; any other file
+ * there is an error.
+ *
+ * Return: The socket's descriptor, or -1 on error.
+ */
+
+int openSocket(char *path, int server)
+{
+	struct sockaddr_un addr;
+	struct stat info;
+	int fd, failed;
+
+	if (strLength(path) >= (int)sizeof(addr.sun_path))
+	{
+		errno = ENAMETOOLONG;
+		return (-1);
+	}
+	fillMemWithByte((char *)&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	copyStr(addr.sun_path, path);
+	if (server && !lstat(path, &info))
+	{
+		if (!S_ISSOCK(info.st_mode))
+		{
+			errno = EEXIST;
+			return (-1);
+		}
+		unlink(path);
+	}
+	fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd == -1)
+		return (-1);
+	failed = server ? (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1
+			|| listen(fd, SOMAXCONN) == -1)
+		: connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == -1;
+	if (failed)
+	{
+		close(fd);
+		return (-1);
+	}
+	return (fd);
+}
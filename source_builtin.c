@@ -0,0 +1,97 @@
+#include "shell.h"
+
+/**
+ * findSourcePath - Finds the file named by the source built-in.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @name: The file name.
+ *
+ * A name without a slash is looked for in PATH first, then in the current
+ * directory.
+ *
+ * Return: The path (to be freed by the caller), or NULL on allocation
+ * failure.
+ */
+
+char *findSourcePath(data_t *data, char *name)
+{
+	char *path = NULL;
+
+	if (!findChar(name, '/'))
+		path = findCmdInPath(data, getEnvironVar(data, "PATH="), name);
+	return (dupStr(path ? path : name));
+}
+
+/**
+ * runSource - Runs a sourced program in the current shell.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @prog: The program (released here).
+ *
+ * Arguments after the file name become the positional parameters while
+ * the file runs, and "return" stops it.
+ *
+ * Return: The exit status of the last command run.
+ */
+
+int runSource(data_t *data, program_t *prog)
+{
+	cmd_state_t state;
+	char **outerArgs = data->posArgs;
+	int outerCount = data->posCount, outerLoops = data->loopDepth;
+
+	saveCmdState(data, &state);
+	if (state.argc > 2)
+	{
+		data->posArgs = state.argv + 2;
+		data->posCount = state.argc - 2;
+	}
+	data->loopDepth = 0;
+	data->execStat = 0;
+	data->sourceDepth++;
+	execProgram(data, prog);
+	data->sourceDepth--;
+	if (data->unwind == UNWIND_RETURN)
+		data->unwind = 0;
+	data->loopDepth = outerLoops;
+	data->posArgs = outerArgs;
+	data->posCount = outerCount;
+	restoreCmdState(data, &state);
+	releaseProgram(prog);
+	return (data->execStat);
+}
+
+/**
+ * sourceCmd - Runs the commands of a file in the current shell (the source
+ * and . built-ins).
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * The parsed file is cached, so sourcing it again costs no reading or
+ * parsing as long as it does not change.
+ *
+ * Return: The exit status of the file's last command, or 2 on error.
+ */
+
+int sourceCmd(data_t *data)
+{
+	program_t *prog;
+	char *path;
+	int status = -1;
+
+	if (!data->argv[1])
+	{
+		printShellErr(data, "filename argument required\n");
+		return (2);
+	}
+	path = findSourcePath(data, data->argv[1]);
+	if (path)
+		status = loadSource(data, path, &prog);
+	free(path);
+	if (status == -1)
+	{
+		printShellErr(data, "can't open ");
+		printErrStr(data, data->argv[1]);
+		printErrChar(data, '\n');
+	}
+	if (status != PARSE_OK)
+		return (2);
+	return (runSource(data, prog));
+}
@@ -0,0 +1,145 @@
+#include "shell.h"
+
+/**
+ * readFileText - Reads the rest of a file into a NUL-terminated string.
+ * @fd: The file descriptor to read from.
+ * @size: The expected size of the file (from fstat() or stat()).
+ *
+ * The buffer is sized from @size up front, so a file that did not change
+ * size is read with one read() call plus the one that sees its end.
+ *
+ * Return: The text (to be freed by the caller), or NULL on error.
+ */
+
+char *readFileText(int fd, size_t size)
+{
+	size_t length = 0, capacity = size + 1;
+	ssize_t bytesRead = 1;
+	char *text = malloc(capacity + 1), *grown;
+
+	while (text && bytesRead > 0)
+	{
+		if (length == capacity)
+		{
+			grown = memRealloc(text, capacity + 1, capacity * 2 + 1);
+			if (!grown)
+				return (free(text), NULL);
+			text = grown;
+			capacity *= 2;
+		}
+		bytesRead = read(fd, text + length, capacity - length);
+		length += (bytesRead > 0) ? bytesRead : 0;
+	}
+	if (text && bytesRead < 0)
+		return (free(text), NULL);
+	if (text)
+		text[length] = '\0';
+	return (text);
+}
+
+/**
+ * cacheSource - Remembers the program parsed from a file.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @src: The file's stale cache entry, or NULL if it has none yet.
+ * @info: The file's status when it was read.
+ * @prog: The parsed program.
+ *
+ * Return: Nothing.
+ */
+
+void cacheSource(data_t *data, source_t *src, struct stat *info,
+		program_t *prog)
+{
+	if (!src)
+	{
+		src = malloc(sizeof(source_t));
+		if (!src)
+			return;
+		src->prog = NULL;
+		src->next = data->sourceCache;
+		data->sourceCache = src;
+	}
+	releaseProgram(src->prog);
+	src->prog = retainProgram(prog);
+	src->dev = info->st_dev;
+	src->ino = info->st_ino;
+	src->mtime = info->st_mtim.tv_sec;
+	src->mtimeNsec = info->st_mtim.tv_nsec;
+	src->size = info->st_size;
+}
+
+/**
+ * loadSource - Returns the parsed program of a file, reading and parsing
+ * it only if it changed since it was last loaded.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @path: Path of the file.
+ * @prog: Where to store the program (to be released by the caller).
+ *
+ * Files are identified by device and inode and considered unchanged while
+ * their modification time and size stay the same, so loading a cached file
+ * costs a single stat(). Anything other than a regular file, such as
+ * /dev/null or a FIFO, is read and parsed every time and never cached.
+ *
+ * Return: PARSE_OK, PARSE_ERROR or PARSE_INCOMPLETE, or -1 if the file
+ * cannot be read.
+ */
+
+int loadSource(data_t *data, char *path, program_t **prog)
+{
+	struct stat info;
+	source_t *src;
+	char *text;
+	int fd, status, line = 0;
+
+	*prog = NULL;
+	STATS_ADD(data, STAT_SYSCALLS, 1);
+	if (stat(path, &info))
+		return (-1);
+	src = S_ISREG(info.st_mode) ? data->sourceCache : NULL;
+	for (; src; src = src->next)
+		if (src->dev == info.st_dev && src->ino == info.st_ino)
+			break;
+	if (src && src->mtime == info.st_mtim.tv_sec && src->size == info.st_size
+			&& src->mtimeNsec == info.st_mtim.tv_nsec)
+	{
+		STATS_ADD(data, STAT_SOURCE_HITS, 1);
+		return (*prog = retainProgram(src->prog), PARSE_OK);
+	}
+	STATS_ADD(data, STAT_SOURCE_MISSES, 1);
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return (-1);
+	text = readFileText(fd, info.st_size);
+	close(fd);
+	if (!text)
+		return (-1);
+	status = parseProgram(data, text, 1, prog);
+	for (fd = 0; status == PARSE_INCOMPLETE && text[fd]; fd++)
+		line += (text[fd] == '\n');
+	if (status == PARSE_INCOMPLETE)
+		printSyntaxErr(data, line, NULL);
+	free(text);
+	if (status == PARSE_OK && S_ISREG(info.st_mode))
+		cacheSource(data, src, &info, *prog);
+	return (status);
+}
+
+/**
+ * clearSourceCache - Frees every cached sourced file.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: Nothing.
+ */
+
+void clearSourceCache(data_t *data)
+{
+	source_t *src;
+
+	while (data->sourceCache)
+	{
+		src = data->sourceCache;
+		data->sourceCache = src->next;
+		releaseProgram(src->prog);
+		free(src);
+	}
+}
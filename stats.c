@@ -0,0 +1,93 @@
+#include "shell.h"
+
+/**
+ * addPhaseTime - Records one run of a phase of the shell's work.
+ * @stats: The statistics.
+ * @phase: The phase (one of the PHASE_* values).
+ * @start: When the run started, from nowNanos().
+ *
+ * The run is counted in the histogram bucket of its duration: bucket 0
+ * holds runs under 1 microsecond, bucket N runs under 2^N microseconds,
+ * and the last bucket everything longer.
+ *
+ * Return: Nothing.
+ */
+
+void addPhaseTime(stats_t *stats, int phase, long start)
+{
+	phase_stat_t *stat = &stats->phases[phase];
+	long took = nowNanos() - start, micros;
+	int bucket = 0;
+
+	for (micros = took / 1000; micros && bucket < STATS_BUCKETS - 1;
+			micros >>= 1)
+		bucket++;
+	stat->count++;
+	stat->total += took;
+	if (took > stat->max)
+		stat->max = took;
+	stat->buckets[bucket]++;
+}
+
+/**
+ * startStats - Turns statistics on, or clears them if they are already on.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: 0 on success, or -1 on allocation failure.
+ */
+
+int startStats(data_t *data)
+{
+	if (!data->stats)
+		data->stats = malloc(sizeof(stats_t));
+	if (!data->stats)
+		return (-1);
+	fillMemWithByte((char *)data->stats, 0, sizeof(stats_t));
+	return (0);
+}
+
+/**
+ * printField - Prints a number right-aligned in a column.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @number: The number.
+ * @width: The column's width.
+ *
+ * Return: Nothing.
+ */
+
+void printField(data_t *data, long number, int width)
+{
+	char *digits = convertNum(data, number, 10, 0);
+	int length = strLength(digits);
+
+	while (length++ < width)
+		putChar(data, ' ');
+	putStr(data, digits);
+}
+
+/**
+ * printPhases - Prints the count and times of each phase.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: Nothing.
+ */
+
+void printPhases(data_t *data)
+{
+	char *names[] = PHASE_NAMES;
+	phase_stat_t *stat;
+	int phase;
+
+	putStr(data, "phase       count    total_us      avg_ns      max_ns\n");
+	for (phase = 0; phase < NUM_PHASES; phase++)
+	{
+		stat = &data->stats->phases[phase];
+		putStr(data, names[phase]);
+		printField(data, stat->count, 17 - strLength(names[phase]));
+		printField(data, stat->total / 1000, 12);
+		printField(data, stat->count ? stat->total / stat->count
+				: 0, 12);
+		printField(data, stat->max, 12);
+		putChar(data, '\n');
+	}
+}
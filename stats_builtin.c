@@ -0,0 +1,133 @@
+#include "shell.h"
+
+/**
+ * printHistogram - Prints the non-empty latency buckets of a phase.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @phase: The phase (one of the PHASE_* values).
+ *
+ * Each bucket is shown as "<Nus:count", or ">=Nus:count" for the last.
+ *
+ * Return: Nothing.
+ */
+
+void printHistogram(data_t *data, int phase)
+{
+	char *names[] = PHASE_NAMES;
+	long *buckets = data->stats->phases[phase].buckets;
+	int bucket, last = STATS_BUCKETS - 1;
+
+	putStr(data, names[phase]);
+	putChar(data, ':');
+	for (bucket = 0; bucket <= last; bucket++)
+	{
+		if (!buckets[bucket])
+			continue;
+		putStr(data, bucket == last ? " >=" : " <");
+		putStr(data, convertNum(data, 1L << (bucket == last ? bucket - 1
+						: bucket), 10, 0));
+		putStr(data, "us:");
+		putStr(data, convertNum(data, buckets[bucket], 10, 0));
+	}
+	putChar(data, '\n');
+}
+
+/**
+ * printCounters - Prints the allocation, system call and cache counters.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: Nothing.
+ */
+
+void printCounters(data_t *data)
+{
+	char *names[] = {"allocs", "syscalls", "cmd_cache", "arith_cache",
+		"glob_cache", "source_cache"};
+	long *counters = data->stats->counters;
+	int idx, hits;
+
+	for (idx = 0; idx < 6; idx++)
+	{
+		putStr(data, names[idx]);
+		putChar(data, ' ');
+		if (idx < 2)
+			putStr(data, convertNum(data, counters[idx], 10, 0));
+		else
+		{
+			hits = STAT_CMD_HITS + 2 * (idx - 2);
+			putStr(data, convertNum(data, counters[hits], 10, 0));
+			putStr(data, " hits ");
+			putStr(data, convertNum(data, counters[hits + 1], 10, 0));
+			putStr(data, " misses");
+		}
+		putChar(data, '\n');
+	}
+}
+
+/**
+ * printCommands - Prints the command count, the time split between
+ * builtins and external commands, and the failures by exit status.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: Nothing.
+ */
+
+void printCommands(data_t *data)
+{
+	long *counters = data->stats->counters;
+	int status;
+
+	putStr(data, "commands ");
+	putStr(data, convertNum(data, counters[STAT_COMMANDS], 10, 0));
+	putStr(data, " builtin_us ");
+	putStr(data, convertNum(data, counters[STAT_BUILTIN_TIME] / 1000, 10, 0));
+	putStr(data, " external_us ");
+	putStr(data, convertNum(data, counters[STAT_EXTERNAL_TIME] / 1000, 10, 0));
+	putStr(data, "\nfailures");
+	for (status = 1; status < 256; status++)
+	{
+		if (!data->stats->failures[status])
+			continue;
+		putChar(data, ' ');
+		putStr(data, convertNum(data, status, 10, 0));
+		putChar(data, ':');
+		putStr(data, convertNum(data, data->stats->failures[status], 10, 0));
+	}
+	putChar(data, '\n');
+}
+
+/**
+ * statsCmd - Implements the stats built-in ("stats [-r]").
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Prints how often each phase of the shell's work ran and how long it
+ * took, with a latency histogram per phase, followed by the counters and
+ * the commands run.
+ * With -r the statistics are cleared instead, which also turns them on if
+ * HSH_STATS was not set when the shell started.
+ *
+ * Return: 0 on success, 1 if statistics are off, or 2 on a usage error.
+ */
+
+int statsCmd(data_t *data)
+{
+	int phase;
+
+	if (data->argv[1] && (cmpStr(data->argv[1], "-r") || data->argv[2]))
+	{
+		printShellErr(data, "usage: stats [-r]\n");
+		return (2);
+	}
+	if (data->argv[1])
+		return (startStats(data) ? 1 : 0);
+	if (!data->stats)
+	{
+		printShellErr(data, "off (set HSH_STATS or run stats -r)\n");
+		return (1);
+	}
+	printPhases(data);
+	for (phase = 0; phase < NUM_PHASES; phase++)
+		printHistogram(data, phase);
+	printCounters(data);
+	printCommands(data);
+	return (0);
+}
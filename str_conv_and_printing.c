@@ -40,23 +40,29 @@ int errStrToInt(char *inputStr)
  * @errorMessage: The error message to be printed.
  *
  * This function displays a shell error message specified @errorMessage.
+ * The command name is left out when no command is running, as for an
+ * error in a redirection.
  *
  * Return: Nothing.
  */
 
 void printShellErr(data_t *data, char *errorMessage)
 {
-	printErrStr(data->fName);
-	printErrStr(": ");
-	printDecimal(data->lineCounter, STDERR_FILENO);
-	printErrStr(": ");
-	printErrStr(data->argv[0]);
-	printErrStr(": ");
-	printErrStr(errorMessage);
+	printErrStr(data, data->fName);
+	printErrStr(data, ": ");
+	printDecimal(data, data->lineCounter, STDERR_FILENO);
+	printErrStr(data, ": ");
+	if (data->argv)
+	{
+		printErrStr(data, data->argv[0]);
+		printErrStr(data, ": ");
+	}
+	printErrStr(data, errorMessage);
 }
 
 /**
  * printDecimal - Writes an integer (decimal number) to a file descriptor.
+ * @data: Pointer to the data_t struct containing shell information.
  * @input: The integer to be written.
  * @fileDescriptor: The file descriptor to which the integer is written.
  *
@@ -66,9 +72,9 @@ void printShellErr(data_t *data, char *errorMessage)
  * Return: The number of characters written.
  */
 
-int printDecimal(int input, int fileDescriptor)
+int printDecimal(data_t *data, int input, int fileDescriptor)
 {
-	int (*printCharFunc)(char) = putChar;
+	int (*printCharFunc)(data_t *, char) = putChar;
 	int index, count = 0;
 	unsigned int absValue, currentDigit;
 
@@ -78,7 +84,7 @@ int printDecimal(int input, int fileDescriptor)
 	if (input < 0)
 	{
 		absValue = -input;
-		printCharFunc('-');
+		printCharFunc(data, '-');
 		count++;
 	}
 	else
@@ -91,13 +97,13 @@ int printDecimal(int input, int fileDescriptor)
 	{
 		if (absValue / index)
 		{
-			printCharFunc('0' + currentDigit / index);
+			printCharFunc(data, '0' + currentDigit / index);
 			count++;
 		}
 		currentDigit %= index;
 	}
 
-	printCharFunc('0' + currentDigit);
+	printCharFunc(data, '0' + currentDigit);
 	count++;
 
 	return (count);
@@ -130,6 +136,7 @@ void removeComments(char *str)
 
 /**
  * convertNum - Converts a long integer to a string representation.
+ * @data: Pointer to the data_t struct containing shell information.
  * @number: The number to be converted.
  * @convBase: The base for conversion.
  * @argFlags: Argument argFlags.
@@ -137,26 +144,26 @@ void removeComments(char *str)
  * This function converts the long integer @number into a string representation
  * with the specified base.
  *
- * Return: The string representation of the number.
+ * Return: The string representation of the number, held in @data until the
+ * next call.
  */
 
-char *convertNum(long int number, int convBase, int argFlags)
+char *convertNum(data_t *data, long int number, int convBase, int argFlags)
 {
-	static char *digitArray;
-	static char buffer[50];
+	char *digitArray;
 	unsigned long absNum = number;
 	char signChar = 0;
 	char *outputPtr;
 
 	if (!(argFlags & CONVERT_TO_UNSIGNED) && number < 0)
 	{
-		absNum = -number;
+		absNum = 0UL - (unsigned long)number;
 		signChar = '-';
 	}
 
 	digitArray = argFlags
 		& CONVERT_TO_LOWERCASE ? "0123456789abcdef" : "0123456789ABCDEF";
-	outputPtr = &buffer[49];
+	outputPtr = &data->numBuf[NUM_BUFFER_SIZE - 1];
 	*outputPtr = '\0';
 
 	do {
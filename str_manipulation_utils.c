@@ -87,3 +87,20 @@ char *findPrefix(const char *string, const char *substring)
 
 	return ((char *)string);
 }
+
+/**
+ * hashStrN - Computes an FNV-1a hash over the first bytes of a string.
+ * @str: The string to hash.
+ * @length: Number of bytes to hash.
+ *
+ * Return: The hash value.
+ */
+
+unsigned int hashStrN(const char *str, int length)
+{
+	unsigned int hash = 2166136261U;
+
+	while (length-- > 0)
+		hash = (hash ^ (unsigned char)*str++) * 16777619U;
+	return (hash ^ (hash >> 16));
+}
@@ -108,3 +108,120 @@ char **strTokenizeDel(char *inStr, char delim)
 	tokens[idxTok] = NULL;
 	return (tokens);
 }
+
+/**
+ * scanWord - Measures one shell word.
+ * @str: The start of the word.
+ * @delim: The delimiter string.
+ * @unclosed: If not NULL, set to 1 when the word ends inside quotes or an
+ * unterminated expansion, and to 0 otherwise.
+ *
+ * Delimiters inside quotes, $(...), $((...)), ${...} and backquotes do not
+ * end the word, and neither does an escaped newline. Command substitutions
+ * and ${...} references are skipped as a whole, even inside double quotes.
+ *
+ * Return: Length of the word.
+ */
+
+int scanWord(char *str, char *delim, int *unclosed)
+{
+	int len, depth = 0, quote = 0, end = 0, cont = 0;
+
+	for (len = 0; str[len] && end >= 0; len++)
+	{
+		if (str[len] == '\\' && quote != '\'')
+		{
+			cont = (str[len + 1] == '\n' && !str[len + 2]);
+			len += (str[len + 1] != '\0');
+		}
+		else if (quote != '\'' && str[len] == '$' && str[len + 1] == '('
+				&& str[len + 2] != '(')
+			end = findSubstEnd(str + len + 2, 0), len += end + 2;
+		else if (quote != '\'' && str[len] == '`')
+			end = findSubstEnd(str + len + 1, 1), len += end + 1;
+		else if (quote != '\'' && str[len] == '$'
+				&& str[len + 1] == '{')
+		{
+			end = findBraceEnd(str + len + 2, quote);
+			len += end + 2;
+		}
+		else if (quote)
+			quote = (str[len] == quote) ? 0 : quote;
+		else if (str[len] == '\'' || str[len] == '"')
+			quote = str[len];
+		else if (str[len] == '$' && str[len + 1] == '(')
+			depth++, len++;
+		else if (depth && str[len] == '(')
+			depth++;
+		else if (depth && str[len] == ')')
+			depth--;
+		else if (!depth && isDelim(str[len], delim))
+			break;
+	}
+	if (end < 0)
+		len = strLength(str);
+	if (unclosed)
+		*unclosed = quote || depth || end < 0 || cont;
+	return (len);
+}
+
+/**
+ * wordLength - Measures one shell word.
+ * @str: The start of the word.
+ * @delim: The delimiter string.
+ *
+ * Return: Length of the word (see scanWord()).
+ */
+
+int wordLength(char *str, char *delim)
+{
+	return (scanWord(str, delim, NULL));
+}
+
+/**
+ * splitWords - Splits a command line into shell words.
+ * @inStr: The input string to be split.
+ * @delim: The delimiter string used for splitting.
+ *
+ * Like strTokenize(), but expansions such as $((a + b)) are kept in one
+ * word even when they contain delimiters.
+ *
+ * Return: A pointer to an array of strings, or NULL on error.
+ */
+
+char **splitWords(char *inStr, char *delim)
+{
+	int inIdx, numToks = 0, len, idxTok;
+	char **tokens;
+
+	if (inStr == NULL || inStr[0] == 0)
+		return (NULL);
+	for (inIdx = 0; inStr[inIdx]; inIdx += len)
+	{
+		while (isDelim(inStr[inIdx], delim))
+			inIdx++;
+		len = wordLength(inStr + inIdx, delim);
+		numToks += (len > 0);
+	}
+	if (numToks == 0)
+		return (NULL);
+	tokens = malloc((1 + numToks) * sizeof(char *));
+	if (!tokens)
+		return (NULL);
+	for (inIdx = 0, idxTok = 0; idxTok < numToks; idxTok++, inIdx += len)
+	{
+		while (isDelim(inStr[inIdx], delim))
+			inIdx++;
+		len = wordLength(inStr + inIdx, delim);
+		tokens[idxTok] = malloc(len + 1);
+		if (!tokens[idxTok])
+		{
+			tokens[idxTok] = NULL;
+			freeStrArr(tokens);
+			return (NULL);
+		}
+		copySubstr(tokens[idxTok], inStr + inIdx, len + 1);
+	}
+	tokens[idxTok] = NULL;
+	return (tokens);
+}
@@ -0,0 +1,157 @@
+#include "shell.h"
+
+/**
+ * testInt - Parses an integer operand of test.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @str: The operand.
+ * @value: Where to store the value.
+ *
+ * Return: 0 on success, or 1 (after reporting it) if @str is not a number.
+ */
+
+int testInt(data_t *data, char *str, long *value)
+{
+	int idx = (*str == '-' || *str == '+'), valid = (str[idx] != '\0');
+
+	for (*value = 0; str[idx] && valid; idx++)
+	{
+		valid = (str[idx] >= '0' && str[idx] <= '9');
+		*value = *value * 10 + (str[idx] - '0');
+	}
+	if (*str == '-')
+		*value = -*value;
+	if (valid)
+		return (0);
+	printShellErr(data, "Illegal number: ");
+	printErrStr(data, str);
+	printErrChar(data, '\n');
+	return (1);
+}
+
+/**
+ * testUnary - Evaluates a unary test such as -n STRING or -d FILE.
+ * @op: The operator.
+ * @arg: The operand.
+ *
+ * Return: 0 if the test is true, 1 if it is false, or -1 if @op is not a
+ * unary operator.
+ */
+
+int testUnary(char *op, char *arg)
+{
+	struct stat fileStat;
+	int found;
+
+	if (op[0] != '-' || !op[1] || op[2])
+		return (-1);
+	if (op[1] == 'n' || op[1] == 'z')
+		return ((*arg != '\0') == (op[1] == 'z'));
+	if (op[1] == 'r' || op[1] == 'w' || op[1] == 'x')
+		return (access(arg, op[1] == 'r' ? R_OK : op[1] == 'w' ? W_OK : X_OK)
+				!= 0);
+	found = (op[1] == 'L' || op[1] == 'h') ? !lstat(arg, &fileStat)
+		: !stat(arg, &fileStat);
+	if (op[1] == 'e')
+		return (!found);
+	if (op[1] == 'f')
+		return (!(found && S_ISREG(fileStat.st_mode)));
+	if (op[1] == 'd')
+		return (!(found && S_ISDIR(fileStat.st_mode)));
+	if (op[1] == 's')
+		return (!(found && fileStat.st_size > 0));
+	if (op[1] == 'L' || op[1] == 'h')
+		return (!(found && S_ISLNK(fileStat.st_mode)));
+	return (-1);
+}
+
+/**
+ * testBinary - Evaluates a binary test such as A = B or A -lt B.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @left: The left operand.
+ * @op: The operator.
+ * @right: The right operand.
+ *
+ * Return: 0 if the test is true, 1 if it is false, 2 if an integer operand
+ * is invalid, or -1 if @op is not a binary operator.
+ */
+
+int testBinary(data_t *data, char *left, char *op, char *right)
+{
+	long a, b;
+	static char * const intOps[] = {"-eq", "-ne", "-lt", "-le", "-gt", "-ge"};
+	int idx, truth;
+
+	if (!cmpStr(op, "=") || !cmpStr(op, "=="))
+		return (cmpStr(left, right) != 0);
+	if (!cmpStr(op, "!="))
+		return (cmpStr(left, right) == 0);
+	for (idx = 0; idx < 6 && cmpStr(op, intOps[idx]); idx++)
+		;
+	if (idx == 6)
+		return (-1);
+	if (testInt(data, left, &a) || testInt(data, right, &b))
+		return (2);
+	truth = (idx == 0) ? a == b : (idx == 1) ? a != b : (idx == 2) ? a < b
+		: (idx == 3) ? a <= b : (idx == 4) ? a > b : a >= b;
+	return (!truth);
+}
+
+/**
+ * testEval - Evaluates the operands of test.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @args: The operands.
+ * @count: Number of operands.
+ *
+ * Follows the POSIX rules by number of operands, with "!" and
+ * parentheses allowed around any of them.
+ *
+ * Return: 0 if the expression is true, 1 if it is false, 2 on error.
+ */
+
+int testEval(data_t *data, char **args, int count)
+{
+	int result = -1;
+
+	if (count == 0)
+		return (1);
+	if (count == 1)
+		return (*args[0] == '\0');
+	if (count == 3)
+		result = testBinary(data, args[0], args[1], args[2]);
+	if (count == 2)
+		result = testUnary(args[0], args[1]);
+	if (result != -1)
+		return (result);
+	if (!cmpStr(args[0], "!"))
+	{
+		result = testEval(data, args + 1, count - 1);
+		return (result == 2 ? 2 : !result);
+	}
+	if (count > 2 && !cmpStr(args[0], "(") && !cmpStr(args[count - 1], ")"))
+		return (testEval(data, args + 1, count - 2));
+	printShellErr(data, "unexpected operator\n");
+	return (2);
+}
+
+/**
+ * testCmd - Evaluates a conditional expression (the test and [ builtins).
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: 0 if the expression is true, 1 if it is false, 2 on error.
+ */
+
+int testCmd(data_t *data)
+{
+	int count = data->argc - 1;
+
+	if (!cmpStr(data->argv[0], "["))
+	{
+		if (!count || cmpStr(data->argv[count], "]"))
+		{
+			printShellErr(data, "missing ]\n");
+			return (2);
+		}
+		count--;
+	}
+	return (testEval(data, data->argv + 1, count));
+}
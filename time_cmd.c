@@ -0,0 +1,68 @@
+#include "shell.h"
+
+/**
+ * printDuration - Prints one line of the time report, like "real 0m1.250s".
+ * @data: Pointer to the data_t struct containing shell information.
+ * @label: The line's label.
+ * @micros: The duration in microseconds.
+ *
+ * Return: Nothing.
+ */
+
+void printDuration(data_t *data, char *label, long micros)
+{
+	long millis = micros / 1000 % 1000;
+
+	printErrStr(data, label);
+	printErrChar(data, '\t');
+	printErrStr(data, convertNum(data, micros / 60000000, 10, 0));
+	printErrChar(data, 'm');
+	printErrStr(data, convertNum(data, micros / 1000000 % 60, 10, 0));
+	printErrChar(data, '.');
+	printErrChar(data, '0' + millis / 100);
+	printErrChar(data, '0' + millis / 10 % 10);
+	printErrChar(data, '0' + millis % 10);
+	printErrStr(data, "s\n");
+}
+
+/**
+ * execTimed - Runs a "time pipeline" command.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @node: The NODE_TIME; its left child is the pipeline.
+ *
+ * Unlike the per-command figures, the report includes the time the shell
+ * itself spent, so builtins and in-process pipelines are timed too. It is
+ * written to the standard error and also becomes the value of the HSH_*
+ * usage variables.
+ *
+ * Return: Nothing; the exit status is the pipeline's.
+ */
+
+void execTimed(data_t *data, node_t *node)
+{
+	usage_t mark, used, before = {0, 0, 0, 0, 0}, after = {0, 0, 0, 0, 0};
+	struct rusage self;
+
+	getrusage(RUSAGE_SELF, &self);
+	addUsage(&before, &self);
+	startUsage(data, &mark);
+	execNode(data, node->left);
+	endUsage(data, &mark, &used);
+	getrusage(RUSAGE_SELF, &self);
+	addUsage(&after, &self);
+	used.user += after.user - before.user;
+	used.sys += after.sys - before.sys;
+	used.csw += after.csw - before.csw;
+	if (!used.maxRss)
+		used.maxRss = after.maxRss;
+	data->lastUsage = used;
+	printDuration(data, "real", used.real);
+	printDuration(data, "user", used.user);
+	printDuration(data, "sys", used.sys);
+	printErrStr(data, "maxrss\t");
+	printErrStr(data, convertNum(data, used.maxRss, 10, 0));
+	printErrStr(data, "k\ncsw\t");
+	printErrStr(data, convertNum(data, used.csw, 10, 0));
+	printErrChar(data, '\n');
+	printErrChar(data, FLUSH_BUFFER_FLAG);
+}
@@ -0,0 +1,148 @@
+#include "../shell.h"
+
+#define MAX_BUILTINS 128
+#define MAX_SEED_TRIES 4000000
+
+/**
+ * struct GenEntry - A builtin name/function pair read from builtins.list.
+ * @name: The builtin command name.
+ * @function: Name of the C function implementing the builtin.
+ * @flags: The BUILTIN_* flags expression, or "0".
+ */
+typedef struct GenEntry
+{
+	char name[64];
+	char function[64];
+	char flags[64];
+} GenEntry;
+
+/**
+ * hashName - Hashes a builtin name exactly like hashBuiltinName() does.
+ * @name: The name to hash.
+ * @seed: The seed to start from.
+ *
+ * Return: The 32-bit hash value.
+ */
+
+unsigned int hashName(const char *name, unsigned int seed)
+{
+	unsigned int hash = seed;
+
+	while (*name)
+		hash = BUILTIN_HASH_STEP(hash, (unsigned char)*name++);
+	return (BUILTIN_HASH_FINAL(hash));
+}
+
+/**
+ * findSeed - Searches for a seed that maps every name to its own slot.
+ * @entries: The builtin entries.
+ * @count: Number of entries.
+ * @size: Table size (a power of two).
+ * @seed: Where to store the seed found.
+ *
+ * Return: 1 if a perfect seed was found, 0 otherwise.
+ */
+
+int findSeed(GenEntry *entries, int count, unsigned int size,
+		unsigned int *seed)
+{
+	unsigned char used[MAX_BUILTINS * 4];
+	unsigned int try, slot;
+	int i;
+
+	for (try = 1; try < MAX_SEED_TRIES; try++)
+	{
+		memset(used, 0, size);
+		for (i = 0; i < count; i++)
+		{
+			slot = hashName(entries[i].name, try) & (size - 1);
+			if (used[slot])
+				break;
+			used[slot] = 1;
+		}
+		if (i == count)
+		{
+			*seed = try;
+			return (1);
+		}
+	}
+	return (0);
+}
+
+/**
+ * printTable - Writes the generated header to stdout.
+ * @entries: The builtin entries.
+ * @count: Number of entries.
+ * @size: Table size.
+ * @seed: The perfect seed.
+ *
+ * Return: Nothing.
+ */
+
+void printTable(GenEntry *entries, int count, unsigned int size,
+		unsigned int seed)
+{
+	unsigned int slot;
+	int i;
+
+	printf("/* Generated by tools/gen_builtin_hash.c - do not edit. */\n");
+	printf("#ifndef BUILTIN_HASH_H\n#define BUILTIN_HASH_H\n\n");
+	printf("#define BUILTIN_HASH_SEED %uU\n", seed);
+	printf("#define BUILTIN_TABLE_SIZE %u\n\n", size);
+	printf("#define BUILTIN_TABLE_ENTRIES \\\n");
+	for (slot = 0; slot < size; slot++)
+	{
+		for (i = 0; i < count; i++)
+			if ((hashName(entries[i].name, seed) & (size - 1)) == slot)
+				break;
+		if (i < count)
+			printf("\t{\"%s\", %s, %s}", entries[i].name,
+					entries[i].function, entries[i].flags);
+		else
+			printf("\t{NULL, NULL, 0}");
+		printf(slot + 1 < size ? ", \\\n" : "\n");
+	}
+	printf("\n#endif /* BUILTIN_HASH_H */\n");
+}
+
+/**
+ * main - Generates the perfect-hash builtin table from builtins.list.
+ *
+ * Usage: gen_builtin_hash < tools/builtins.list > builtin_hash.h
+ *
+ * Return: 0 on success, 1 otherwise.
+ */
+
+int main(void)
+{
+	GenEntry entries[MAX_BUILTINS];
+	char line[256];
+	int count = 0, fields;
+	unsigned int size = 1, seed = 0;
+
+	while (fgets(line, sizeof(line), stdin) && count < MAX_BUILTINS)
+	{
+		if (line[0] == '#' || line[0] == '\n')
+			continue;
+		fields = sscanf(line, "%63s %63s %63s", entries[count].name,
+				entries[count].function, entries[count].flags);
+		if (fields < 2)
+			continue;
+		if (fields == 2)
+			strcpy(entries[count].flags, "0");
+		count++;
+	}
+	while (size < (unsigned int)count)
+		size <<= 1;
+	while (!findSeed(entries, count, size, &seed))
+	{
+		size <<= 1;
+		if (size > MAX_BUILTINS * 4)
+		{
+			fprintf(stderr, "gen_builtin_hash: no perfect seed found\n");
+			return (1);
+		}
+	}
+	printTable(entries, count, size, seed);
+	return (0);
+}
@@ -0,0 +1,140 @@
+#include "shell.h"
+
+/**
+ * describeCmd - Prints how a command name would be interpreted.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @name: The command name.
+ * @verbose: 1 for type-style sentences, 0 for command -v style output.
+ *
+ * Return: 0 if the name was found, or 1 otherwise.
+ */
+
+int describeCmd(data_t *data, char *name, int verbose)
+{
+	resolved_t cmd;
+
+	resolveCommand(data, name, 0, &cmd);
+	if (cmd.type == CMD_NOT_FOUND)
+	{
+		if (verbose)
+		{
+			printShellErr(data, name);
+			printErrStr(data, ": not found\n");
+		}
+		return (1);
+	}
+	if (!verbose)
+	{
+		if (cmd.type == CMD_ALIAS)
+			putStr(data, "alias "), putStr(data, name), putStr(data, "='"),
+				putStr(data, cmd.value), putStr(data, "'\n");
+		else
+			putStr(data, cmd.type == CMD_FILE ? cmd.path : name), putChar(data, '\n');
+		return (0);
+	}
+	putStr(data, name);
+	if (cmd.type == CMD_ALIAS)
+		putStr(data, " is aliased to `"), putStr(data, cmd.value), putStr(data, "'\n");
+	else if (cmd.type == CMD_BUILTIN)
+		putStr(data, " is a shell builtin\n");
+	else if (cmd.type == CMD_FUNCTION)
+		putStr(data, " is a function\n");
+	else
+		putStr(data, " is "), putStr(data, cmd.path), putChar(data, '\n');
+	return (0);
+}
+
+/**
+ * typeCmd - Describes each argument as an alias, builtin, function or file.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: 0 if every name was found, or 1 otherwise.
+ */
+
+int typeCmd(data_t *data)
+{
+	int idx, status = 0;
+
+	for (idx = 1; data->argv[idx]; idx++)
+		if (describeCmd(data, data->argv[idx], 1))
+			status = 1;
+	return (status);
+}
+
+/**
+ * shiftArgs - Drops the first argument of the current command.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Return: Nothing.
+ */
+
+void shiftArgs(data_t *data)
+{
+	int idx;
+
+	free(data->argv[0]);
+	for (idx = 0; data->argv[idx]; idx++)
+		data->argv[idx] = data->argv[idx + 1];
+	data->argc--;
+}
+
+/**
+ * commandCmd - Emulates the command built-in.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * With -v or -V each name is described (briefly or verbosely). Otherwise the
+ * remaining arguments are run as a builtin or external command, bypassing
+ * aliases and functions.
+ *
+ * Return: The status of the described or executed command.
+ */
+
+int commandCmd(data_t *data)
+{
+	resolved_t cmd;
+	int idx, verbose, status = 0;
+
+	if (data->argv[1] && (!cmpStr(data->argv[1], "-v")
+				|| !cmpStr(data->argv[1], "-V")))
+	{
+		verbose = data->argv[1][1] == 'V';
+		for (idx = 2; data->argv[idx]; idx++)
+			if (describeCmd(data, data->argv[idx], verbose))
+				status = 1;
+		return (status);
+	}
+	shiftArgs(data);
+	if (!data->argv[0])
+		return (0);
+	resolveCommand(data, data->argv[0], 1, &cmd);
+	if (cmd.builtin)
+		return (cmd.builtin->function(data));
+	locateAndExecCmd(data);
+	return (data->execStat);
+}
+
+/**
+ * whichCmd - Prints the full path of each external command name.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * Like which(1), only executables found in PATH are printed; the answer
+ * comes from the command resolver instead of a separate process.
+ *
+ * Return: 0 if every name was found, or 1 otherwise.
+ */
+
+int whichCmd(data_t *data)
+{
+	resolved_t cmd;
+	int idx, status = 0;
+
+	for (idx = 1; data->argv[idx]; idx++)
+	{
+		resolveCommand(data, data->argv[idx], 1, &cmd);
+		if (cmd.path)
+			putStr(data, cmd.path), putChar(data, '\n');
+		else
+			status = 1;
+	}
+	return (status);
+}
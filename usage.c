@@ -0,0 +1,107 @@
+#include "shell.h"
+
+/**
+ * nowNanos - Reads the monotonic clock.
+ *
+ * Return: The time in nanoseconds.
+ */
+
+long nowNanos(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec * 1000000000L + now.tv_nsec);
+}
+
+/**
+ * addUsage - Adds resource usage reported by the kernel to a total.
+ * @total: The total.
+ * @ru: The usage, from wait4() or getrusage().
+ *
+ * Times and context switches are summed; the resident set size is the
+ * largest seen.
+ *
+ * Return: Nothing.
+ */
+
+void addUsage(usage_t *total, struct rusage *ru)
+{
+	total->user += ru->ru_utime.tv_sec * 1000000L + ru->ru_utime.tv_usec;
+	total->sys += ru->ru_stime.tv_sec * 1000000L + ru->ru_stime.tv_usec;
+	total->csw += ru->ru_nvcsw + ru->ru_nivcsw;
+	if (ru->ru_maxrss > total->maxRss)
+		total->maxRss = ru->ru_maxrss;
+}
+
+/**
+ * startUsage - Starts measuring a command.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @mark: Where to store the starting point.
+ *
+ * Measurements nest: the largest resident set size seen so far is kept in
+ * @mark and merged back by endUsage().
+ *
+ * Return: Nothing.
+ */
+
+void startUsage(data_t *data, usage_t *mark)
+{
+	*mark = data->children;
+	mark->real = nowNanos() / 1000;
+	data->children.maxRss = 0;
+}
+
+/**
+ * endUsage - Finishes measuring a command.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @mark: The starting point stored by startUsage().
+ * @used: Where to store the command's usage: its elapsed time and what
+ * the child processes reaped meanwhile used.
+ *
+ * Return: Nothing.
+ */
+
+void endUsage(data_t *data, usage_t *mark, usage_t *used)
+{
+	usage_t *children = &data->children;
+	long peak = children->maxRss;
+
+	used->real = nowNanos() / 1000 - mark->real;
+	used->user = children->user - mark->user;
+	used->sys = children->sys - mark->sys;
+	used->csw = children->csw - mark->csw;
+	used->maxRss = peak;
+	children->maxRss = peak > mark->maxRss ? peak : mark->maxRss;
+}
+
+/**
+ * usageValue - Finds the value of one of the resource usage variables.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @name: The variable name (need not be NUL-terminated).
+ * @length: Length of @name.
+ *
+ * HSH_REAL, HSH_USER and HSH_SYS are in microseconds, HSH_MAXRSS in
+ * kilobytes and HSH_CSW counts context switches, all for the last command.
+ *
+ * Return: The value, or NULL if @name is none of them.
+ */
+
+char *usageValue(data_t *data, const char *name, int length)
+{
+	char *names[] = {"HSH_REAL", "HSH_USER", "HSH_SYS", "HSH_MAXRSS",
+		"HSH_CSW", NULL};
+	long values[5];
+	int idx;
+
+	values[0] = data->lastUsage.real;
+	values[1] = data->lastUsage.user;
+	values[2] = data->lastUsage.sys;
+	values[3] = data->lastUsage.maxRss;
+	values[4] = data->lastUsage.csw;
+	for (idx = 0; names[idx]; idx++)
+		if (strLength(names[idx]) == length
+				&& !cmpStrN(names[idx], (char *)name, length))
+			return (convertNum(data, values[idx], 10, 0));
+	return (NULL);
+}
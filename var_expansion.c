@@ -0,0 +1,165 @@
+#include "shell.h"
+
+/**
+ * appendExpBuf - Appends bytes to the shell's expansion buffer.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @str: The bytes to append.
+ * @length: Number of bytes to append.
+ *
+ * The buffer is kept across lines and only grows, so expanding a word
+ * normally costs no allocation at all. A backslash in the buffer makes the
+ * next character literal in patterns, so every backslash appended gets
+ * one, and so does every quoted '*', '?' or '['.
+ *
+ * Return: 0 on success, or 1 on allocation failure.
+ */
+
+int appendExpBuf(data_t *data, const char *str, size_t length)
+{
+	int quoted = data->expQuoted & 2, err = 0;
+	size_t idx, start = 0;
+
+	for (idx = 0; idx < length; idx++)
+		if (str[idx] == '\\' || (quoted && (str[idx] == '*'
+						|| str[idx] == '?' || str[idx] == '[')))
+		{
+			err |= appendStrBuf(&data->exp, str + start, idx - start);
+			err |= appendStrBuf(&data->exp, "\\", 1);
+			start = idx;
+		}
+	return (err | appendStrBuf(&data->exp, str + start, length - start));
+}
+
+/**
+ * expandBraced - Expands a ${...} reference, including its operators.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @str: Pointer to the '$' introducing the reference.
+ *
+ * Return: Number of characters of @str consumed, or 0 if the reference is
+ * malformed.
+ */
+
+int expandBraced(data_t *data, char *str)
+{
+	int end = findBraceEnd(str + 2, data->expQuoted & 2), lengthOp, nameLen;
+	char *name, *value;
+
+	if (end < 1)
+		return (0);
+	lengthOp = (str[2] == '#' && end > 1);
+	name = str + 2 + lengthOp;
+	nameLen = paramNameLen(name);
+	if (!nameLen)
+		return (0);
+	while (*name >= '0' && *name <= '9' && name[nameLen] >= '0'
+			&& name[nameLen] <= '9')
+		nameLen++;
+	if (name + nameLen == str + 2 + end && !lengthOp)
+		appendParam(data, name, nameLen);
+	else if (name + nameLen == str + 2 + end)
+	{
+		value = paramValue(data, name, nameLen);
+		value = convertNum(data, value ? strLength(value) : 0, 10, 0);
+		appendExpBuf(data, value, strLength(value));
+	}
+	else if (lengthOp || applyParamOp(data, name, nameLen, name + nameLen,
+				str + 2 + end - (name + nameLen)))
+		return (0);
+	return (end + 3);
+}
+
+/**
+ * expandParam - Expands the parameter reference at the start of a string.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @str: Pointer to the '$' (or backquote) introducing the reference.
+ *
+ * Handles $NAME, the special parameters, every ${...} form, $((...))
+ * arithmetic and $(...) or `...` command substitution. A '$' that does not
+ * start a valid reference is copied literally.
+ *
+ * Return: Number of characters of @str consumed.
+ */
+
+int expandParam(data_t *data, char *str)
+{
+	int length = 0;
+
+	if (*str == '`' || (str[1] == '(' && str[2] != '('))
+		length = expandCmdSubst(data, str);
+	else if (str[1] == '(')
+		length = expandArith(data, str);
+	else if (str[1] == '{')
+		length = expandBraced(data, str);
+	else if ((length = paramNameLen(str + 1)))
+		appendParam(data, str + 1, length++);
+	if (!length)
+	{
+		appendExpBuf(data, str, 1);
+		return (1);
+	}
+	return (length);
+}
+
+/**
+ * expandInto - Appends the expansion of a word to the expansion buffer.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @word: The word to expand.
+ *
+ * Quotes and backslashes are removed as the word is copied. Inside double
+ * quotes, as in the word of "${u-word}", single quotes are literal and a
+ * backslash only escapes $, `, ", \, newline and }.
+ *
+ * Return: Nothing.
+ */
+
+void expandInto(data_t *data, char *word)
+{
+	char *start = word;
+	int dquoted;
+
+	while (*word)
+	{
+		dquoted = data->expQuoted & 2;
+		if (!isDelim(*word, dquoted ? "$`\"\\" : "$`'\"\\") || (dquoted
+					&& *word == '\\' && !isDelim(word[1], "$`\"\\\n}")))
+		{
+			word++;
+			continue;
+		}
+		appendExpBuf(data, start, word - start);
+		if (*word == '$' || *word == '`')
+			start = word + expandParam(data, word);
+		else
+			start = word + expandQuoted(data, word);
+		word = start;
+	}
+	appendExpBuf(data, start, word - start);
+}
+
+/**
+ * expandWord - Expands every parameter reference inside a word.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @word: The word to expand.
+ *
+ * The word is scanned once, copying literal runs and parameter values into
+ * the expansion buffer, so references may appear anywhere in a word (for
+ * example --prefix=$HOME/opt or ${VAR}x).
+ *
+ * Return: 1 if the word contained a reference or quoting (the result is
+ * in @data->exp), or 0 if the word is unchanged.
+ */
+
+int expandWord(data_t *data, char *word)
+{
+	char *str = word;
+
+	data->expQuoted = 0;
+	while (*str && !isDelim(*str, "$`'\"\\"))
+		str++;
+	if (!*str)
+		return (0);
+	data->exp.len = 0;
+	data->expSplit = 0;
+	expandInto(data, word);
+	return (1);
+}
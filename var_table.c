@@ -0,0 +1,141 @@
+#include "shell.h"
+
+/**
+ * rebuildVarIndex - Rebuilds the hash index over the environment list.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * The index maps variable names to their nodes in @data->envList. It is
+ * rebuilt lazily, only after variables have been added or removed; changing
+ * the value of an existing variable keeps its node and the index valid.
+ *
+ * Return: 0 on success, or 1 on allocation failure.
+ */
+
+int rebuildVarIndex(data_t *data)
+{
+	item_t *node;
+	size_t size = 16, count = getListLen(data->envList);
+	unsigned int slot;
+	char *eqlPosition;
+
+	while (size < count * 2)
+		size <<= 1;
+	if (size != data->varIndexSize)
+	{
+		free(data->varIndex);
+		data->varIndex = malloc(sizeof(item_t *) * size);
+		data->varIndexSize = data->varIndex ? size : 0;
+		if (!data->varIndex)
+			return (1);
+	}
+	fillMemWithByte((char *)data->varIndex, 0, sizeof(item_t *) * size);
+	for (node = data->envList; node; node = node->next)
+	{
+		eqlPosition = findChar(node->string, '=');
+		if (!eqlPosition)
+			continue;
+		slot = hashStrN(node->string, eqlPosition - node->string);
+		slot &= size - 1;
+		while (data->varIndex[slot])
+			slot = (slot + 1) & (size - 1);
+		data->varIndex[slot] = node;
+	}
+	data->varIndexValid = 1;
+	return (0);
+}
+
+/**
+ * findVarNode - Finds the environment list node of a variable in constant
+ * time.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @name: The variable name (need not be NUL-terminated).
+ * @length: Length of @name.
+ *
+ * Return: The "NAME=value" node, or NULL if the variable is not set.
+ */
+
+item_t *findVarNode(data_t *data, const char *name, int length)
+{
+	unsigned int slot, mask;
+	item_t *node;
+
+	if (!data->varIndexValid && rebuildVarIndex(data))
+		return (NULL);
+	mask = data->varIndexSize - 1;
+	slot = hashStrN(name, length) & mask;
+	while ((node = data->varIndex[slot]))
+	{
+		if (!cmpStrN(node->string, (char *)name, length)
+				&& node->string[length] == '=')
+			return (node);
+		slot = (slot + 1) & mask;
+	}
+	return (NULL);
+}
+
+/**
+ * lookupVar - Finds the value of a variable in constant time.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @name: The variable name (need not be NUL-terminated).
+ * @length: Length of @name.
+ *
+ * Return: Pointer to the value inside the environment list, or NULL if the
+ * variable is not set.
+ */
+
+char *lookupVar(data_t *data, const char *name, int length)
+{
+	item_t *node = findVarNode(data, name, length);
+
+	return (node ? node->string + length + 1 : NULL);
+}
+
+/**
+ * isNameChar - Checks if a character may appear in a variable name.
+ * @character: The character to check.
+ * @first: True if @character would be the first character of the name.
+ *
+ * Return: 1 if it may, 0 otherwise.
+ */
+
+int isNameChar(char character, int first)
+{
+	if (isAlpha(character) || character == '_')
+		return (1);
+	return (!first && character >= '0' && character <= '9');
+}
+
+/**
+ * paramValue - Finds the value of a named or special parameter.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @name: The parameter name (need not be NUL-terminated).
+ * @length: Length of @name.
+ *
+ * Special parameters ($?, $$ and $0) and the HSH_* resource usage
+ * variables are formatted on the fly, and the positional ones come from
+ * positionalValue(); everything else comes from lookupVar(). $$ is the
+ * shell's own process ID, even in a subshell or command substitution.
+ *
+ * Return: The value, or NULL if the parameter is not set.
+ */
+
+char *paramValue(data_t *data, const char *name, int length)
+{
+	char *value;
+
+	if (length == 1 && *name == '?')
+		return (convertNum(data, data->execStat, 10, 0));
+	if (length == 1 && *name == '$')
+		return (convertNum(data, data->shellPid, 10, 0));
+	if (length == 1 && *name == '0')
+		return (data->fName);
+	if (isDelim(*name, "#@*123456789"))
+		return (positionalValue(data, name, length));
+	if (length > 4 && !cmpStrN((char *)name, "HSH_", 4))
+	{
+		value = usageValue(data, name, length);
+		if (value)
+			return (value);
+	}
+	return (lookupVar(data, name, length));
+}
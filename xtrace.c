@@ -0,0 +1,133 @@
+#include "shell.h"
+
+/**
+ * traceChar - Writes a character to the execution trace.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @character: The character to write, or FLUSH_BUFFER_FLAG.
+ *
+ * The trace has its own buffer, flushed when it is full, before the shell
+ * forks and when tracing stops, so tracing costs about one write() per
+ * buffer of trace lines.
+ *
+ * Return: 1.
+ */
+
+int traceChar(data_t *data, char character)
+{
+	outbuf_t *out = &data->trace.out;
+	int fd = data->trace.fd;
+
+	if (character == FLUSH_BUFFER_FLAG || out->len >= WRITE_BUFFER_SIZE)
+	{
+		if (out->len && (fd == FD_SINK_OUT || fd == FD_SINK_ERR))
+			data->sink->write(data->sink->ctx, fd == FD_SINK_OUT ? 1 : 2,
+					out->buf, out->len);
+		else if (out->len && fd >= 0)
+			write(fd, out->buf, out->len);
+		out->len = 0;
+	}
+	if (character != FLUSH_BUFFER_FLAG)
+		out->buf[out->len++] = character;
+	return (1);
+}
+
+/**
+ * traceStr - Writes a string to the execution trace.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @str: The string.
+ *
+ * Return: Nothing.
+ */
+
+void traceStr(data_t *data, char *str)
+{
+	while (str && *str)
+		traceChar(data, *str++);
+}
+
+/**
+ * traceFixed - Writes a fixed-point number to the execution trace.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @value: The number, scaled by 10^@digits (at least 0).
+ * @digits: Number of decimal places (at least 1).
+ *
+ * Return: Nothing.
+ */
+
+void traceFixed(data_t *data, long value, int digits)
+{
+	long scale = 1;
+	char *text;
+	int idx;
+
+	for (idx = 0; idx < digits; idx++)
+		scale *= 10;
+	traceStr(data, convertNum(data, value / scale, 10, 0));
+	text = convertNum(data, value % scale + scale, 10, 0);
+	text[0] = '.';
+	traceStr(data, text);
+}
+
+/**
+ * traceCommand - Writes the trace line of a finished simple command.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @start: When the command started, from nowNanos().
+ *
+ * The line gives the monotonic time the command started, its line number,
+ * its expanded words, how long it took and its exit status, like
+ * "+ [1712.004512] line 12: sleep 1 (1.001034s, status 0)".
+ *
+ * Return: Nothing.
+ */
+
+void traceCommand(data_t *data, long start)
+{
+	long took = nowNanos() - start;
+	int idx;
+
+	traceStr(data, "+ [");
+	traceFixed(data, start / 1000, 6);
+	traceStr(data, "] line ");
+	traceStr(data, convertNum(data, data->lineCounter, 10, 0));
+	traceChar(data, ':');
+	for (idx = 0; data->argv[idx]; idx++)
+	{
+		traceChar(data, ' ');
+		traceStr(data, data->argv[idx]);
+	}
+	traceStr(data, " (");
+	traceFixed(data, took / 1000, 6);
+	traceStr(data, "s, status ");
+	traceStr(data, convertNum(data, data->execStat, 10, 0));
+	traceStr(data, ")\n");
+}
+
+/**
+ * startTrace - Turns the execution trace on or off.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @on: True for "set -x", false for "set +x".
+ *
+ * The trace goes to the descriptor named by HSH_XTRACEFD when tracing is
+ * turned on, or to the standard error if that is unset or not open. The
+ * shell writes it through a private copy of that descriptor, so the
+ * redirections of the commands traced do not move it.
+ *
+ * Return: Nothing.
+ */
+
+void startTrace(data_t *data, int on)
+{
+	char *value = getEnvironVar(data, "HSH_XTRACEFD=");
+	int fd = value ? errStrToInt(value) : -1;
+
+	traceChar(data, FLUSH_BUFFER_FLAG);
+	if (data->trace.fd >= 0)
+		close(data->trace.fd);
+	data->trace.fd = -1;
+	if (!on)
+		return;
+	if (fd >= 0)
+		data->trace.fd = dupSessionFd(data, fd);
+	if (data->trace.fd == -1)
+		data->trace.fd = dupSessionFd(data, STDERR_FILENO);
+}
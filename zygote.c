@@ -0,0 +1,209 @@
+#include "shell.h"
+
+/**
+ * startZygote - Starts the zygote if HSH_ZYGOTE is set in the environment.
+ * @data: Pointer to the data_t struct containing shell information.
+ *
+ * HSH_ZYGOTE gives the number of children kept parked. The zygote is
+ * forked while the shell is still small, so it and the children it forks
+ * are cheap to create. The children are created as children of the shell,
+ * which waits for them like any other.
+ *
+ * Return: Nothing; without a zygote, commands are forked as usual.
+ */
+
+void startZygote(data_t *data)
+{
+	int idx, count = 0, pair[2];
+	char *value;
+	pid_t pid;
+
+	for (idx = 0; environ[idx] && !count; idx++)
+	{
+		value = findPrefix(environ[idx], "HSH_ZYGOTE=");
+		if (value)
+			count = errStrToInt(value);
+	}
+	if (count < 1
+			|| socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, pair) == -1)
+		return;
+	pid = fork();
+	if (pid == 0)
+	{
+		close(pair[0]);
+		runZygote(pair[1], count);
+	}
+	close(pair[1]);
+	if (pid == -1)
+	{
+		close(pair[0]);
+		return;
+	}
+	data->zygote.fd = pair[0];
+	data->zygote.owner = getpid();
+}
+
+/**
+ * runZygote - Main loop of the zygote process.
+ * @sock: The children's end of the request socket.
+ * @count: Number of children to keep parked.
+ *
+ * Each parked child takes one request from the socket and tells the
+ * zygote through a pipe, which then forks a replacement. The zygote dies
+ * with the shell.
+ *
+ * Return: Nothing; it never returns.
+ */
+
+void runZygote(int sock, int count)
+{
+	int refill[2];
+	char byte;
+
+	prctl(PR_SET_PDEATHSIG, SIGKILL);
+	if (pipe(refill) == -1)
+		_exit(1);
+	fcntl(refill[0], F_SETFD, FD_CLOEXEC);
+	fcntl(refill[1], F_SETFD, FD_CLOEXEC);
+	while (1)
+	{
+		while (count > 0)
+		{
+			switch (syscall(SYS_clone, CLONE_PARENT | SIGCHLD, 0, NULL, NULL, 0))
+			{
+			case 0:
+				parkChild(sock, refill[1]);
+				break;
+			case -1:
+				poll(NULL, 0, 100);
+				break;
+			default:
+				count--;
+			}
+		}
+		if (read(refill[0], &byte, 1) == 1)
+			count++;
+		else if (errno != EINTR)
+			_exit(0);
+	}
+}
+
+/**
+ * packRequest - Builds the message asking the zygote to run a program.
+ * @request: Buffer receiving the message.
+ * @mask: Bit N set when descriptor N is passed on.
+ * @path: The program.
+ * @argv: Its arguments.
+ * @envp: Its environment.
+ *
+ * The message is @mask and the number of arguments and environment
+ * strings, followed by @path and those strings, each ending in '\0'.
+ *
+ * Return: 0 on success, or -1 on error or if the message is too large.
+ */
+
+int packRequest(strbuf_t *request, int mask, char *path, char **argv,
+		char **envp)
+{
+	char **lists[2];
+	int header[3], list, idx;
+
+	lists[0] = argv;
+	lists[1] = envp;
+	header[0] = mask;
+	for (list = 0; list < 2; list++)
+		for (header[list + 1] = 0; lists[list][header[list + 1]];)
+			header[list + 1]++;
+	if (appendStrBuf(request, (char *)header, sizeof(header))
+			|| appendStrBuf(request, path, strLength(path) + 1))
+		return (-1);
+	for (list = 0; list < 2; list++)
+		for (idx = 0; lists[list][idx]; idx++)
+			if (appendStrBuf(request, lists[list][idx],
+						strLength(lists[list][idx]) + 1))
+				return (-1);
+	return (request->len > ZYGOTE_MAX_REQUEST ? -1 : 0);
+}
+
+/**
+ * sendRequest - Sends a request and its descriptors to the parked children.
+ * @sock: The shell's end of the request socket.
+ * @request: The message built by packRequest().
+ * @fds: The descriptors: the working directory, then the passed ones.
+ * @count: Number of descriptors.
+ *
+ * Return: The process ID of the child that took the request, or -1 on
+ * error.
+ */
+
+pid_t sendRequest(int sock, strbuf_t *request, int *fds, int count)
+{
+	char control[CMSG_SPACE(sizeof(int) * (ZYGOTE_MAX_FDS + 1))];
+	struct msghdr msg;
+	struct iovec iov;
+	struct cmsghdr *cmsg;
+	pid_t pid;
+	int idx;
+
+	fillMemWithByte((char *)&msg, 0, sizeof(msg));
+	fillMemWithByte(control, 0, sizeof(control));
+	iov.iov_base = request->buf;
+	iov.iov_len = request->len;
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control;
+	msg.msg_controllen = CMSG_SPACE(sizeof(int) * count);
+	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(int) * count);
+	for (idx = 0; idx < count; idx++)
+		((int *)CMSG_DATA(cmsg))[idx] = fds[idx];
+	if (sendmsg(sock, &msg, MSG_NOSIGNAL) == -1
+			|| readAll(sock, (char *)&pid, sizeof(pid)) == -1)
+		return (-1);
+	return (pid);
+}
+
+/**
+ * zygoteSpawn - Runs a program in one of the zygote's parked children.
+ * @data: Pointer to the data_t struct containing shell information.
+ * @path: The program.
+ * @argv: Its arguments.
+ * @envp: Its environment.
+ *
+ * The child gets the shell's working directory and its descriptors below
+ * ZYGOTE_MAX_FDS that are not close-on-exec, as a forked child would.
+ *
+ * Return: The child's process ID, or -1 if the caller must fork instead.
+ */
+
+pid_t zygoteSpawn(data_t *data, char *path, char **argv, char **envp)
+{
+	int fds[ZYGOTE_MAX_FDS + 1], count = 1, mask = 0, fd, flags;
+	strbuf_t request = {NULL, 0, 0};
+	pid_t pid = -1;
+
+	if (data->zygote.fd == -1 || data->zygote.owner != getpid())
+		return (-1);
+	for (fd = 0; fd < ZYGOTE_MAX_FDS; fd++)
+	{
+		flags = fcntl(fd, F_GETFD);
+		if (flags != -1 && !(flags & FD_CLOEXEC))
+			fds[count++] = fd, mask |= 1 << fd;
+	}
+	fds[0] = open(".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (fds[0] != -1 && !packRequest(&request, mask, path, argv, envp))
+	{
+		pid = sendRequest(data->zygote.fd, &request, fds, count);
+		if (pid == -1)
+		{
+			close(data->zygote.fd);
+			data->zygote.fd = -1;
+		}
+	}
+	if (fds[0] != -1)
+		close(fds[0]);
+	free(request.buf);
+	return (pid);
+}
@@ -0,0 +1,129 @@
+#include "shell.h"
+
+/**
+ * unpackStrings - Splits part of a zygote request into a string array.
+ * @cursor: Address of the pointer to the first string; advanced past the
+ * last one.
+ * @count: Number of strings.
+ *
+ * Return: The NULL-terminated array, or NULL on allocation failure.
+ */
+
+char **unpackStrings(char **cursor, int count)
+{
+	char **strings = malloc(sizeof(char *) * (count + 1));
+	int idx;
+
+	if (!strings)
+		return (NULL);
+	for (idx = 0; idx < count; idx++)
+	{
+		strings[idx] = *cursor;
+		*cursor += strLength(*cursor) + 1;
+	}
+	strings[count] = NULL;
+	return (strings);
+}
+
+/**
+ * placeFds - Moves descriptors received from the shell to their numbers.
+ * @fds: The received descriptors, in increasing order of their numbers in
+ * the shell.
+ * @count: Number of descriptors.
+ * @mask: Bit N set when descriptor N was passed on.
+ *
+ * The received descriptors are first moved out of the way, so none is
+ * overwritten before it is placed. Descriptors below ZYGOTE_MAX_FDS that
+ * the shell did not pass on are closed.
+ *
+ * Return: Nothing.
+ */
+
+void placeFds(int *fds, int count, int mask)
+{
+	int idx, target, moved;
+
+	for (idx = 0; idx < count; idx++)
+	{
+		moved = fcntl(fds[idx], F_DUPFD_CLOEXEC, ZYGOTE_MAX_FDS);
+		close(fds[idx]);
+		fds[idx] = moved;
+	}
+	for (idx = 0, target = 0; target < ZYGOTE_MAX_FDS; target++)
+	{
+		if ((mask & (1 << target)) && idx < count)
+			dup2(fds[idx++], target);
+		else
+			close(target);
+	}
+}
+
+/**
+ * takeRequest - Waits for a request from the shell.
+ * @sock: The children's end of the request socket.
+ * @buf: Buffer of ZYGOTE_MAX_REQUEST bytes receiving the message.
+ * @fds: Array receiving the descriptors sent with it.
+ * @count: Where to store the number of descriptors.
+ *
+ * Return: The message's length, or -1 on error.
+ */
+
+ssize_t takeRequest(int sock, char *buf, int *fds, int *count)
+{
+	char control[CMSG_SPACE(sizeof(int) * (ZYGOTE_MAX_FDS + 1))];
+	struct msghdr msg;
+	struct iovec iov;
+	struct cmsghdr *cmsg;
+	ssize_t len;
+
+	fillMemWithByte((char *)&msg, 0, sizeof(msg));
+	iov.iov_base = buf;
+	iov.iov_len = ZYGOTE_MAX_REQUEST;
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+	do {
+		len = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC);
+	} while (len == -1 && errno == EINTR);
+	*count = 0;
+	cmsg = len > 0 ? CMSG_FIRSTHDR(&msg) : NULL;
+	if (cmsg && cmsg->cmsg_type == SCM_RIGHTS)
+		for (; CMSG_LEN(sizeof(int) * (*count + 1)) <= cmsg->cmsg_len; (*count)++)
+			fds[*count] = ((int *)CMSG_DATA(cmsg))[*count];
+	return (len);
+}
+
+/**
+ * parkChild - Waits for one request from the shell and runs its program.
+ * @sock: The children's end of the request socket.
+ * @refill: Pipe telling the zygote to fork a replacement.
+ *
+ * The child's process ID goes back to the shell as soon as the request is
+ * taken, so the shell can wait for it while the program starts.
+ *
+ * Return: Nothing; the child execs or exits.
+ */
+
+void parkChild(int sock, int refill)
+{
+	char *buf = malloc(ZYGOTE_MAX_REQUEST), *path, **argv, **envp;
+	int header[3], fds[ZYGOTE_MAX_FDS + 1], count, idx;
+	pid_t pid = getpid();
+
+	if (!buf || takeRequest(sock, buf, fds, &count) < (ssize_t)sizeof(header))
+		_exit(0);
+	send(sock, &pid, sizeof(pid), MSG_NOSIGNAL);
+	write(refill, "", 1);
+	for (idx = 0; idx < (int)sizeof(header); idx++)
+		((char *)header)[idx] = buf[idx];
+	path = buf + sizeof(header);
+	buf = path + strLength(path) + 1;
+	argv = unpackStrings(&buf, header[1]);
+	envp = unpackStrings(&buf, header[2]);
+	if (!count || fchdir(fds[0]) == -1 || !argv || !envp)
+		_exit(1);
+	placeFds(fds + 1, count - 1, header[0]);
+	execve(path, argv, envp);
+	_exit(errno == EACCES ? 126 : 1);
+}